@@ -0,0 +1,48 @@
+import time
+
+import pytest
+
+# The suite is written for the 'benchmark' fixture of pytest-benchmark,
+# which reports statistics and compares saved runs.  Without that plugin a
+# minimal replacement is provided which runs each benchmark a few times and
+# prints the fastest round, such that the suite can still be run.
+
+try:
+    import pytest_benchmark  # noqa: F401
+except ImportError:
+
+    class Benchmark:
+        def __init__(self, name):
+            self.name = name
+            self.extra_info = {}
+            self.best = None
+
+        def pedantic(self, target, args=(), kwargs=None, setup=None, rounds=5,
+                     iterations=1, warmup_rounds=0):
+            for _ in range(warmup_rounds + rounds):
+                call_args, call_kwargs = args, kwargs or {}
+                if setup is not None:
+                    prepared = setup()
+                    if prepared is not None:
+                        call_args, call_kwargs = prepared
+                start = time.perf_counter()
+                for _ in range(iterations):
+                    result = target(*call_args, **call_kwargs)
+                elapsed = (time.perf_counter() - start) / iterations
+                if self.best is None or elapsed < self.best:
+                    self.best = elapsed
+            return result
+
+        def __call__(self, target, *args, **kwargs):
+            return self.pedantic(target, args, kwargs)
+
+        def report(self):
+            info = " ".join(f"{k}={v}" for k, v in self.extra_info.items())
+            print(f"\n{self.name}: {self.best * 1e3:.3f} ms {info}")
+
+    @pytest.fixture
+    def benchmark(request):
+        result = Benchmark(request.node.name)
+        yield result
+        if result.best is not None:
+            result.report()
@@ -0,0 +1,194 @@
+import itertools
+import random
+
+import pytest
+from pydical import Solver, SATISFIABLE, UNSATISFIABLE
+
+# Benchmarks of the overhead of the Python bindings, i.e., of casting
+# arguments and results, calling Python callbacks through 'std::function'
+# and capturing exceptions in callbacks.  The formulas are chosen such that
+# the time spent in the solver itself is small compared to the bindings.
+#
+# Run with 'pytest benchmarks' and pytest-benchmark installed, which allows
+# to save and compare runs, e.g., '--benchmark-autosave' and
+# '--benchmark-compare'.  The number of callbacks or clauses per round is
+# stored in 'extra_info' to compute rates.
+
+
+def random_clauses(variables, clauses, k=3, seed=42):
+    rng = random.Random(seed)
+    result = []
+    for _ in range(clauses):
+        vars = rng.sample(range(1, variables + 1), k)
+        result.append([var * rng.choice((-1, 1)) for var in vars])
+    return result
+
+
+def pigeon_hole(n):
+    def ph(p, h):
+        return 1 + h * (n + 1) + p
+
+    result = []
+    for h in range(n):
+        for p1, p2 in itertools.combinations(range(n + 1), 2):
+            result.append([-ph(p1, h), -ph(p2, h)])
+    for p in range(n + 1):
+        result.append([ph(p, h) for h in range(n)])
+    return result
+
+
+def fresh(clauses):
+    s = Solver()
+    s.add_clauses(clauses)
+    return s
+
+
+CLAUSES = random_clauses(10000, 40000)
+LITERALS = sum(len(clause) for clause in CLAUSES)
+
+# Clause addition.
+
+
+def add_literals(s, clauses):
+    add = s.add
+    for clause in clauses:
+        for lit in clause:
+            add(lit)
+        add(0)
+
+
+def add_clause(s, clauses):
+    for clause in clauses:
+        s.add_clause(clause)
+
+
+def add_clauses(s, clauses):
+    s.add_clauses(clauses)
+
+
+@pytest.mark.parametrize(
+    "method", [add_literals, add_clause, add_clauses], ids=lambda m: m.__name__
+)
+def test_add(benchmark, method):
+    benchmark.extra_info["clauses"] = len(CLAUSES)
+    benchmark.extra_info["literals"] = LITERALS
+    benchmark.pedantic(
+        method, setup=lambda: ((Solver(), CLAUSES), {}), rounds=10
+    )
+
+
+# Learned clause callbacks, where exporting all clauses maximizes the
+# number of calls through the bindings.  Solving without a learner gives
+# the baseline.
+
+PIGEON_HOLE = pigeon_hole(7)
+
+
+def solve(s):
+    assert s.solve() == UNSATISFIABLE
+
+
+def test_solve_without_learner(benchmark):
+    benchmark.pedantic(
+        solve, setup=lambda: ((fresh(PIGEON_HOLE),), {}), rounds=5
+    )
+
+
+def test_learner(benchmark):
+    calls = [0]
+
+    def learning(size):
+        calls[0] += 1
+        return True
+
+    def learn(lit):
+        calls[0] += 1
+
+    def setup():
+        calls[0] = 0
+        s = fresh(PIGEON_HOLE)
+        s.connect_learner(learning, learn)
+        return (s,), {}
+
+    benchmark.pedantic(solve, setup=setup, rounds=5)
+    benchmark.extra_info["callbacks"] = calls[0]
+
+
+# Traversing and collecting clauses and witnesses.  Eliminating variables
+# of an under-constrained random formula produces many witnesses.
+
+TRAVERSED = fresh(CLAUSES)
+
+ELIMINATED = fresh(random_clauses(10000, 20000))
+ELIMINATED.simplify(3)
+
+
+def test_traverse_clauses(benchmark):
+    count = [0]
+
+    def clause(c):
+        count[0] += 1
+        return True
+
+    def traverse():
+        count[0] = 0
+        TRAVERSED.traverse_clauses(clause)
+
+    benchmark(traverse)
+    benchmark.extra_info["clauses"] = count[0]
+
+
+def test_clauses(benchmark):
+    result = benchmark(TRAVERSED.clauses)
+    benchmark.extra_info["clauses"] = len(result)
+
+
+def test_traverse_witnesses(benchmark):
+    count = [0]
+
+    def witness(clause, witness):
+        count[0] += 1
+        return True
+
+    def traverse():
+        count[0] = 0
+        ELIMINATED.traverse_witnesses_forward(witness)
+
+    benchmark(traverse)
+    benchmark.extra_info["witnesses"] = count[0]
+
+
+def test_witnesses(benchmark):
+    result = benchmark(ELIMINATED.witnesses)
+    benchmark.extra_info["witnesses"] = len(result)
+
+
+# Latency of incremental solve calls on a tiny formula, with and without
+# assumptions and with reading back the model.  The formula is an
+# implication chain, which stays satisfiable under each assumption.
+
+INCREMENTAL = 1000
+TINY = [[-i, i + 1] for i in range(1, 8)] + [[1, 2, 3]]
+
+
+def incremental(s, assume, model):
+    for i in range(INCREMENTAL):
+        if assume:
+            s.assume(1 + i % 8)
+        assert s.solve() == SATISFIABLE
+        if model:
+            [s.val(lit) for lit in range(1, 9)]
+
+
+@pytest.mark.parametrize(
+    "assume, model",
+    [(False, False), (True, False), (True, True)],
+    ids=["plain", "assume", "model"],
+)
+def test_incremental(benchmark, assume, model):
+    benchmark.extra_info["calls"] = INCREMENTAL
+    benchmark.pedantic(
+        incremental,
+        setup=lambda: ((fresh(TINY), assume, model), {}),
+        rounds=5,
+    )
@@ -0,0 +1,294 @@
+#ifndef _families_hpp_INCLUDED
+#define _families_hpp_INCLUDED
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Generators for scalable families of benchmark instances shared by the
+// benchmark drivers.  All generators are deterministic, i.e., the same
+// parameters give the same formula on all platforms, such that results of
+// different builds and machines can be compared.
+
+namespace Families {
+
+typedef std::vector<std::vector<int>> Clauses;
+
+// Simple linear congruential generator (same as 'Random' in 'random.hpp'
+// but kept separate to not depend on internal headers).
+
+class Generator {
+  uint64_t state;
+public:
+  Generator (uint64_t seed) : state (seed) { }
+  uint64_t next () {
+    state *= 6364136223846793005ul;
+    state += 1442695040888963407ul;
+    return state;
+  }
+  unsigned pick (unsigned n) { return (next () >> 32) % n; }
+};
+
+// Uniform random 'k'-SAT with 'n' variables and 'm' clauses.  Each clause
+// has 'k' different variables with random signs.
+
+inline Clauses random_ksat (int k, int n, int m, uint64_t seed = 42) {
+  Generator random (seed);
+  Clauses res;
+  std::vector<int> clause;
+  while ((int) res.size () < m) {
+    clause.clear ();
+    while ((int) clause.size () < k) {
+      const int idx = 1 + random.pick (n);
+      bool fresh = true;
+      for (const auto & lit : clause)
+        if (lit == idx || lit == -idx) fresh = false;
+      if (!fresh) continue;
+      clause.push_back (random.pick (2) ? idx : -idx);
+    }
+    res.push_back (clause);
+  }
+  return res;
+}
+
+// Random 'k'-SAT at the satisfiability threshold, i.e., with the clause
+// variable ratio where instances are hardest (for 'k' from 3 to 7).
+
+inline Clauses random_threshold (int k, int n, uint64_t seed = 42) {
+  static const double ratios[] = { 4.26, 9.93, 21.12, 43.37, 87.79 };
+  const double ratio = ratios[k < 3 ? 0 : k > 7 ? 4 : k - 3];
+  return random_ksat (k, n, (int) (ratio * n + 0.5), seed);
+}
+
+inline Clauses random_3sat (int n, uint64_t seed = 42) {
+  return random_threshold (3, n, seed);
+}
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes (unsatisfiable).
+
+inline Clauses pigeon_hole (int n) {
+  Clauses res;
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        res.push_back ({ -ph (p1, h), -ph (p2, h) });
+  for (int p = 0; p < n + 1; p++) {
+    std::vector<int> clause;
+    for (int h = 0; h < n; h++)
+      clause.push_back (ph (p, h));
+    res.push_back (clause);
+  }
+  return res;
+}
+
+// Tseitin encoding of circuits built from 'and' and 'xor' gates.
+
+class Circuit {
+  int vars;
+public:
+  Clauses clauses;
+  Circuit () : vars (0) { }
+  int input () { return ++vars; }
+  int constant (bool value) {
+    const int res = ++vars;
+    clauses.push_back ({ value ? res : -res });
+    return res;
+  }
+  int and_gate (int a, int b) {
+    const int res = ++vars;
+    clauses.push_back ({ -res, a });
+    clauses.push_back ({ -res, b });
+    clauses.push_back ({ res, -a, -b });
+    return res;
+  }
+  int or_gate (int a, int b) { return -and_gate (-a, -b); }
+  int xor_gate (int a, int b) {
+    const int res = ++vars;
+    clauses.push_back ({ -res, a, b });
+    clauses.push_back ({ -res, -a, -b });
+    clauses.push_back ({ res, -a, b });
+    clauses.push_back ({ res, a, -b });
+    return res;
+  }
+  void full_adder (int a, int b, int c, int & sum, int & carry) {
+    const int t = xor_gate (a, b);
+    sum = xor_gate (t, c);
+    carry = or_gate (and_gate (a, b), and_gate (t, c));
+  }
+  std::vector<int> inputs (int width) {
+    std::vector<int> res;
+    for (int i = 0; i < width; i++)
+      res.push_back (input ());
+    return res;
+  }
+  // Ripple carry adder of two words of the same width with one more bit
+  // for the carry out.
+  std::vector<int> add (const std::vector<int> & a,
+                        const std::vector<int> & b) {
+    std::vector<int> res;
+    int carry = constant (false);
+    for (size_t i = 0; i < a.size (); i++) {
+      int sum;
+      full_adder (a[i], b[i], carry, sum, carry);
+      res.push_back (sum);
+    }
+    res.push_back (carry);
+    return res;
+  }
+  // Array multiplier (summing up shifted partial products).
+  std::vector<int> multiply (const std::vector<int> & a,
+                             const std::vector<int> & b) {
+    const size_t width = a.size () + b.size ();
+    const int zero = constant (false);
+    std::vector<int> res (width, zero);
+    for (size_t j = 0; j < b.size (); j++) {
+      std::vector<int> row (width, zero);
+      for (size_t i = 0; i < a.size (); i++)
+        row[i + j] = and_gate (a[i], b[j]);
+      res = add (res, row);
+      res.pop_back ();
+    }
+    return res;
+  }
+  void equal (const std::vector<int> & word, uint64_t value) {
+    for (size_t i = 0; i < word.size (); i++)
+      clauses.push_back ({ (value >> i) & 1 ? word[i] : -word[i] });
+  }
+};
+
+inline bool is_prime (uint64_t n) {
+  if (n < 2) return false;
+  for (uint64_t d = 2; d * d <= n; d++)
+    if (!(n % d)) return false;
+  return true;
+}
+
+inline uint64_t largest_prime_below (uint64_t n) {
+  while (!is_prime (--n))
+    ;
+  return n;
+}
+
+// Factoring 'product' with a multiplier of two 'width' bit factors which
+// both have to be larger than one.  This is unsatisfiable if the product
+// is prime (as for the 'prime*.cnf' files in 'test/cnf').
+
+inline Clauses factoring (int width, uint64_t product) {
+  Circuit circuit;
+  const auto a = circuit.inputs (width), b = circuit.inputs (width);
+  circuit.equal (circuit.multiply (a, b), product);
+  std::vector<int> a_not_one (a.begin () + 1, a.end ());
+  std::vector<int> b_not_one (b.begin () + 1, b.end ());
+  circuit.clauses.push_back (a_not_one);
+  circuit.clauses.push_back (b_not_one);
+  return circuit.clauses;
+}
+
+// The largest prime with '2*width-1' bits (unsatisfiable).
+
+inline Clauses factoring_prime (int width) {
+  const uint64_t bound = (uint64_t) 1 << (2*width - 1);
+  return factoring (width, largest_prime_below (bound));
+}
+
+// Primes close to the largest 'width' bit number have mostly one bits and
+// make factoring trivial.  Instead the factors are picked in the middle of
+// the 'width' bit range (satisfiable).
+
+inline Clauses factoring_semiprime (int width) {
+  const uint64_t p = largest_prime_below ((uint64_t) 3 << (width - 2));
+  const uint64_t q = largest_prime_below ((uint64_t) 5 << (width - 3));
+  return factoring (width, p * q);
+}
+
+// Square root of the square of a 'width' bit prime similar to the
+// 'sqrt*.cnf' files (satisfiable).
+
+inline Clauses square_root (int width) {
+  const uint64_t p = largest_prime_below ((uint64_t) 3 << (width - 2));
+  Circuit circuit;
+  const auto a = circuit.inputs (width);
+  circuit.equal (circuit.multiply (a, a), p * p);
+  return circuit.clauses;
+}
+
+// Miter checking commutativity of two ripple carry adders of two 'width'
+// bit words, similar to the 'add*.cnf' files (unsatisfiable).
+
+inline Clauses adder_miter (int width) {
+  Circuit circuit;
+  const auto a = circuit.inputs (width), b = circuit.inputs (width);
+  const auto s = circuit.add (a, b), t = circuit.add (b, a);
+  std::vector<int> differ;
+  for (size_t i = 0; i < s.size (); i++)
+    differ.push_back (circuit.xor_gate (s[i], t[i]));
+  circuit.clauses.push_back (differ);
+  return circuit.clauses;
+}
+
+// Specifications of instances are of the form '<family>:<size>'.  Sizes
+// of the arithmetic families are bounded to fit into 64 bit products.
+
+inline bool valid (const std::string & spec) {
+  const size_t colon = spec.find (':');
+  if (colon == std::string::npos) return false;
+  const std::string family = spec.substr (0, colon);
+  const int size = atoi (spec.c_str () + colon + 1);
+  if (size <= 0) return false;
+  if (family == "rand3" || family == "rand4" || family == "rand5")
+    return true;
+  if (family == "ph" || family == "add") return true;
+  if (family == "prime") return 1 < size && size <= 20;
+  if (family == "factor" || family == "sqrt") return 2 < size && size <= 31;
+  return false;
+}
+
+// Generate an instance from a specification and return 'false' if the
+// family is unknown or the size invalid.
+
+inline bool generate (const std::string & spec, Clauses & clauses) {
+  if (!valid (spec)) return false;
+  const size_t colon = spec.find (':');
+  const std::string family = spec.substr (0, colon);
+  const int size = atoi (spec.c_str () + colon + 1);
+  if (family == "rand3") clauses = random_threshold (3, size);
+  else if (family == "rand4") clauses = random_threshold (4, size);
+  else if (family == "rand5") clauses = random_threshold (5, size);
+  else if (family == "ph") clauses = pigeon_hole (size);
+  else if (family == "prime") clauses = factoring_prime (size);
+  else if (family == "factor") clauses = factoring_semiprime (size);
+  else if (family == "sqrt") clauses = square_root (size);
+  else clauses = adder_miter (size);
+  return true;
+}
+
+inline int maximum_variable (const Clauses & clauses) {
+  int res = 0;
+  for (const auto & clause : clauses)
+    for (const auto & lit : clause)
+      if (abs (lit) > res) res = abs (lit);
+  return res;
+}
+
+// Write in DIMACS format and return 'false' on failure.
+
+inline bool write_dimacs (const Clauses & clauses,
+                          const std::string & path) {
+  FILE * file = fopen (path.c_str (), "w");
+  if (!file) return false;
+  fprintf (file, "p cnf %d %zd\n",
+    maximum_variable (clauses), clauses.size ());
+  for (const auto & clause : clauses) {
+    for (const auto & lit : clause)
+      fprintf (file, "%d ", lit);
+    fputs ("0\n", file);
+  }
+  return !fclose (file);
+}
+
+}
+
+#endif
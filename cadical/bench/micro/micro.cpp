@@ -0,0 +1,498 @@
+// Micro benchmarks for the solver kernels.  In contrast to the API tests
+// these benchmarks use internal data structures directly and thus have to
+// be compiled with exactly the same flags as the library (see 'run.sh').
+
+#include "../../src/internal.hpp"
+#include "../families.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+
+using namespace std;
+using namespace CaDiCaL;
+using namespace Families;
+
+/*------------------------------------------------------------------------*/
+
+static const char * usage =
+"usage: micro [ <option> ... ] [ <filter> ]\n"
+"\n"
+"where '<option>' is one of the following\n"
+"\n"
+"  -h                 print this command line option summary\n"
+"  -l                 only list names of benchmarks\n"
+"  --min-time=<sec>   minimum time per benchmark (default 0.5 seconds)\n"
+"  --json=<path>      write results as JSON to '<path>'\n"
+"\n"
+"and only benchmarks with '<filter>' as sub-string in their name are run.\n"
+;
+
+/*------------------------------------------------------------------------*/
+
+// Only the code between 'start' and 'stop' is measured, which allows to
+// exclude setup code from measurements.
+
+struct Timer {
+  typedef chrono::steady_clock clock;
+  clock::time_point started;
+  double seconds;
+  Timer () : seconds (0) { }
+  void start () { started = clock::now (); }
+  void stop () {
+    chrono::duration<double> delta = clock::now () - started;
+    seconds += delta.count ();
+  }
+};
+
+// A benchmark runs one iteration on each call of 'run', which returns the
+// number of processed items (propagations, clauses, bytes, etc.).
+
+struct Benchmark {
+  string name;
+  const char * unit;
+  function<int64_t (Timer &)> run;
+};
+
+struct Result {
+  string name;
+  const char * unit;
+  int64_t iterations;
+  double seconds;
+  int64_t items;
+};
+
+static string directory () {
+  const char * prefix = getenv ("CADICALBUILD");
+  return prefix ? prefix : ".";
+}
+
+/*------------------------------------------------------------------------*/
+
+// The solver kernels work on an 'Internal' solver without going through
+// the API, which would add too much noise.  The formula is added through
+// 'External' though to properly initialize variables.
+
+struct Kernel {
+  Internal * internal;
+  External * external;
+  Kernel (const Clauses & clauses) {
+    internal = new Internal ();
+    external = new External (internal);
+    internal->opts.quiet = true;
+    for (const auto & clause : clauses) {
+      for (const auto & lit : clause)
+        external->add (lit);
+      external->add (0);
+    }
+    internal->init_preprocessing_limits ();
+    internal->init_search_limits ();
+  }
+  ~Kernel () {
+    delete internal;
+    delete external;
+  }
+};
+
+// Assign variables in a fixed random order and propagate until a conflict
+// is found or all variables are assigned.
+
+static int64_t propagate (Timer & timer, Kernel & kernel, int64_t round) {
+  Internal * internal = kernel.internal;
+  Generator random (round);
+  const int64_t before = internal->stats.propagations.search;
+  const int n = internal->max_var;
+  timer.start ();
+  for (int i = 0; i < n; i++) {
+    const int idx = 1 + (i + random.pick (n)) % n;
+    if (internal->val (idx)) continue;
+    internal->search_assume_decision (random.pick (2) ? idx : -idx);
+    if (!internal->propagate ()) break;
+  }
+  internal->backtrack ();
+  internal->conflict = 0;
+  timer.stop ();
+  return internal->stats.propagations.search - before;
+}
+
+// Run plain CDCL (without restarts, reductions and inprocessing) for the
+// given number of conflicts and only measure conflict analysis including
+// clause minimization.
+
+static int64_t analyze (Timer & timer, const Clauses & clauses, int limit) {
+  Kernel kernel (clauses);
+  Internal * internal = kernel.internal;
+  if (!internal->propagate ()) return 0;
+  int64_t conflicts = 0;
+  while (!internal->unsat && conflicts < limit) {
+    if (!internal->propagate ()) {
+      timer.start ();
+      internal->analyze ();
+      timer.stop ();
+      internal->iterating = false;
+      conflicts++;
+    } else if (internal->satisfied ()) break;
+    else internal->decide ();
+  }
+  return conflicts;
+}
+
+/*------------------------------------------------------------------------*/
+
+struct larger_score {
+  const vector<double> & scores;
+  larger_score (const vector<double> & s) : scores (s) { }
+  bool operator () (unsigned a, unsigned b) { return scores[a] < scores[b]; }
+};
+
+// Same pattern as in stable mode: fill, bump random elements and then
+// pop elements in score order.
+
+static int64_t heap_operations (Timer & timer, unsigned n, int64_t round) {
+  Generator random (round);
+  vector<double> scores (n);
+  for (auto & score : scores)
+    score = random.pick (1000);
+  timer.start ();
+  CaDiCaL::heap<larger_score> heap { larger_score (scores) };
+  for (unsigned e = 0; e < n; e++)
+    heap.push_back (e);
+  for (unsigned i = 0; i < n; i++) {
+    const unsigned e = random.pick (n);
+    scores[e] += 1000;
+    heap.update (e);
+  }
+  while (!heap.empty ())
+    heap.pop_front ();
+  timer.stop ();
+  return 3 * (int64_t) n;
+}
+
+struct identity_rank {
+  uint64_t operator () (uint64_t a) const { return a; }
+};
+
+static int64_t sorting (Timer & timer, size_t n, int64_t round, bool radix) {
+  Generator random (round);
+  vector<uint64_t> data (n);
+  for (auto & d : data)
+    d = random.next ();
+  timer.start ();
+  if (radix) rsort (data.begin (), data.end (), identity_rank ());
+  else sort (data.begin (), data.end ());
+  timer.stop ();
+  return n;
+}
+
+// Moving garbage collection copies all clauses into the arena, which only
+// happens after the first two collections (see 'arenaing').
+
+static int64_t arena_collection (Timer & timer, Kernel & kernel) {
+  Internal * internal = kernel.internal;
+  timer.start ();
+  internal->garbage_collection ();
+  timer.stop ();
+  return internal->stats.current.irredundant;
+}
+
+/*------------------------------------------------------------------------*/
+
+static int64_t parse (Timer & timer, const string & path) {
+  Solver solver;
+  solver.set ("quiet", 1);
+  int vars;
+  timer.start ();
+  const char * err = solver.read_dimacs (path.c_str (), vars, 1);
+  timer.stop ();
+  if (err) {
+    fprintf (stderr, "micro: error: %s\n", err);
+    exit (1);
+  }
+  FILE * file = fopen (path.c_str (), "r");
+  fseek (file, 0, SEEK_END);
+  const int64_t bytes = ftell (file);
+  fclose (file);
+  return bytes;
+}
+
+static int64_t trace (Timer & timer, Tracer * tracer,
+                      const Clauses & clauses) {
+  timer.start ();
+  for (const auto & clause : clauses)
+    tracer->add_derived_clause (clause);
+  for (const auto & clause : clauses)
+    tracer->delete_clause (clause);
+  timer.stop ();
+  return 2 * clauses.size ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// A proof step is a derived clause or a deleted clause if 'deleted' is set.
+
+struct Step {
+  bool deleted;
+  vector<int> clause;
+};
+
+// Produce a DRAT proof with the solver and read it back.
+
+static vector<Step> prove (const Clauses & clauses, const string & path) {
+  {
+    Solver solver;
+    solver.set ("binary", 0);
+    solver.set ("quiet", 1);
+    solver.trace_proof (path.c_str ());
+    for (const auto & clause : clauses) {
+      for (const auto & lit : clause)
+        solver.add (lit);
+      solver.add (0);
+    }
+    solver.solve ();
+  }
+  vector<Step> res;
+  FILE * file = fopen (path.c_str (), "r");
+  if (!file) return res;
+  Step step { false, { } };
+  int ch;
+  while ((ch = getc (file)) != EOF) {
+    if (ch == 'd') { step.deleted = true; continue; }
+    if (ch == ' ' || ch == '\n') continue;
+    ungetc (ch, file);
+    int lit;
+    if (fscanf (file, "%d", &lit) != 1) break;
+    if (lit) { step.clause.push_back (lit); continue; }
+    res.push_back (step);
+    step.deleted = false;
+    step.clause.clear ();
+  }
+  fclose (file);
+  return res;
+}
+
+static int64_t check (Timer & timer, const Clauses & clauses,
+                      const vector<Step> & steps) {
+  Internal internal;
+  internal.opts.quiet = true;
+  Checker checker (&internal);
+  for (const auto & clause : clauses)
+    checker.add_original_clause (clause);
+  timer.start ();
+  for (const auto & step : steps)
+    if (step.deleted) checker.delete_clause (step.clause);
+    else checker.add_derived_clause (step.clause);
+  timer.stop ();
+  return steps.size ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Instances are generated lazily, i.e., only if a benchmark using them is
+// actually run, and then shared by all iterations.  The unique pointers
+// are shared by the copies of the benchmark functions.
+
+static vector<Benchmark> benchmarks () {
+
+  vector<Benchmark> res;
+
+  for (int n : { 2000, 20000 }) {
+    auto kernel = make_shared<unique_ptr<Kernel>> ();
+    auto round = make_shared<int64_t> (0);
+    res.push_back ({ "propagate/rand3/" + to_string (n), "propagations",
+      [=] (Timer & timer) {
+        if (!*kernel) kernel->reset (new Kernel (random_3sat (n)));
+        return propagate (timer, **kernel, ++*round);
+      }});
+  }
+
+  for (int n : { 10, 20 }) {
+    auto kernel = make_shared<unique_ptr<Kernel>> ();
+    auto round = make_shared<int64_t> (0);
+    res.push_back ({ "propagate/ph/" + to_string (n), "propagations",
+      [=] (Timer & timer) {
+        if (!*kernel) kernel->reset (new Kernel (pigeon_hole (n)));
+        return propagate (timer, **kernel, ++*round);
+      }});
+  }
+
+  for (int n : { 300, 3000 }) {
+    auto clauses = make_shared<Clauses> ();
+    res.push_back ({ "analyze/rand3/" + to_string (n), "conflicts",
+      [=] (Timer & timer) {
+        if (clauses->empty ()) *clauses = random_3sat (n);
+        return analyze (timer, *clauses, 1000);
+      }});
+  }
+
+  {
+    auto clauses = make_shared<Clauses> ();
+    res.push_back ({ "analyze/ph/9", "conflicts",
+      [=] (Timer & timer) {
+        if (clauses->empty ()) *clauses = pigeon_hole (9);
+        return analyze (timer, *clauses, 1000);
+      }});
+  }
+
+  for (unsigned n : { 10000u, 100000u }) {
+    auto round = make_shared<int64_t> (0);
+    res.push_back ({ "heap/" + to_string (n), "operations",
+      [=] (Timer & timer) { return heap_operations (timer, n, ++*round); }});
+  }
+
+  for (size_t n : { 1000, 100000, 1000000 })
+    for (bool radix : { true, false }) {
+      auto round = make_shared<int64_t> (0);
+      const string name = radix ? "rsort/" : "sort/";
+      res.push_back ({ name + to_string (n), "elements",
+        [=] (Timer & timer) { return sorting (timer, n, ++*round, radix); }});
+    }
+
+  for (int n : { 20000, 100000 }) {
+    auto kernel = make_shared<unique_ptr<Kernel>> ();
+    res.push_back ({ "arena/rand3/" + to_string (n), "clauses",
+      [=] (Timer & timer) {
+        if (!*kernel) {
+          kernel->reset (new Kernel (random_3sat (n)));
+          (*kernel)->internal->garbage_collection ();
+          (*kernel)->internal->garbage_collection ();
+          assert ((*kernel)->internal->arenaing ());
+        }
+        return arena_collection (timer, **kernel);
+      }});
+  }
+
+  for (int n : { 100000 }) {
+    const string path =
+      directory () + "/bench-micro-rand3-" + to_string (n) + ".cnf";
+    auto written = make_shared<bool> (false);
+    res.push_back ({ "parse/rand3/" + to_string (n), "bytes",
+      [=] (Timer & timer) {
+        if (!*written) *written = write_dimacs (random_3sat (n), path);
+        return parse (timer, path);
+      }});
+  }
+
+  {
+    auto clauses = make_shared<Clauses> ();
+    auto internal = make_shared<unique_ptr<Internal>> ();
+    auto tracer = make_shared<unique_ptr<Tracer>> ();
+    res.push_back ({ "tracer/binary/rand3/100000", "clauses",
+      [=] (Timer & timer) {
+        if (!*tracer) {
+          *clauses = random_3sat (100000);
+          internal->reset (new Internal ());
+          (*internal)->opts.quiet = true;
+          File * file = File::write (internal->get (), "/dev/null");
+          tracer->reset (new Tracer (internal->get (), file, true));
+        }
+        return trace (timer, tracer->get (), *clauses);
+      }});
+  }
+
+  for (int n : { 7, 8 }) {
+    auto clauses = make_shared<Clauses> ();
+    auto steps = make_shared<vector<Step>> ();
+    const string path =
+      directory () + "/bench-micro-ph-" + to_string (n) + ".drat";
+    res.push_back ({ "checker/ph/" + to_string (n), "steps",
+      [=] (Timer & timer) {
+        if (clauses->empty ()) {
+          *clauses = pigeon_hole (n);
+          *steps = prove (*clauses, path);
+        }
+        return check (timer, *clauses, *steps);
+      }});
+  }
+
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Iterations are repeated until the measured time reaches the minimum time.
+
+static Result run (Benchmark & benchmark, double min_time) {
+  Result res { benchmark.name, benchmark.unit, 0, 0, 0 };
+  Timer timer;
+  do {
+    res.items += benchmark.run (timer);
+    res.iterations++;
+  } while (timer.seconds < min_time && res.iterations < 1000000);
+  res.seconds = timer.seconds;
+  return res;
+}
+
+static void print (const Result & r) {
+  const double ns = 1e9 * r.seconds / r.iterations;
+  const double rate = r.seconds ? r.items / r.seconds : 0;
+  printf ("%-32s %10" PRId64 " %14.0f ns %12.3f M %s/s\n",
+    r.name.c_str (), r.iterations, ns, rate * 1e-6, r.unit);
+  fflush (stdout);
+}
+
+// Follows the JSON format of Google Benchmark, such that existing scripts
+// for comparing and tracking results can be used.
+
+static bool write_json (const vector<Result> & results,
+                        const char * path, double min_time) {
+  FILE * file = fopen (path, "w");
+  if (!file) return false;
+  const time_t now = time (0);
+  char date[64];
+  strftime (date, sizeof date, "%Y-%m-%dT%H:%M:%S", localtime (&now));
+  fprintf (file, "{\n  \"context\": {\n");
+  fprintf (file, "    \"date\": \"%s\",\n", date);
+  fprintf (file, "    \"library\": \"CaDiCaL %s\",\n", version ());
+  fprintf (file, "    \"compiler\": \"%s\",\n", compiler ());
+  fprintf (file, "    \"min_time\": %g\n", min_time);
+  fprintf (file, "  },\n  \"benchmarks\": [");
+  for (size_t i = 0; i < results.size (); i++) {
+    const Result & r = results[i];
+    fprintf (file, "%s\n    {\n", i ? "," : "");
+    fprintf (file, "      \"name\": \"%s\",\n", r.name.c_str ());
+    fprintf (file, "      \"iterations\": %" PRId64 ",\n", r.iterations);
+    fprintf (file, "      \"real_time\": %.3f,\n",
+      1e9 * r.seconds / r.iterations);
+    fprintf (file, "      \"time_unit\": \"ns\",\n");
+    fprintf (file, "      \"items_per_second\": %.3f,\n",
+      r.seconds ? r.items / r.seconds : 0);
+    fprintf (file, "      \"items\": \"%s\"\n    }", r.unit);
+  }
+  fprintf (file, "\n  ]\n}\n");
+  return !fclose (file);
+}
+
+int main (int argc, char ** argv) {
+  const char * filter = 0, * json = 0;
+  double min_time = 0.5;
+  bool list = false;
+  for (int i = 1; i < argc; i++) {
+    const char * arg = argv[i];
+    if (!strcmp (arg, "-h")) { fputs (usage, stdout); return 0; }
+    else if (!strcmp (arg, "-l")) list = true;
+    else if (!strncmp (arg, "--min-time=", 11)) min_time = atof (arg + 11);
+    else if (!strncmp (arg, "--json=", 7)) json = arg + 7;
+    else if (arg[0] == '-') {
+      fprintf (stderr, "micro: error: invalid option '%s' (try '-h')\n", arg);
+      return 1;
+    } else if (filter) {
+      fprintf (stderr, "micro: error: multiple filters '%s' and '%s'\n",
+        filter, arg);
+      return 1;
+    } else filter = arg;
+  }
+  vector<Result> results;
+  for (auto & benchmark : benchmarks ()) {
+    if (filter && !strstr (benchmark.name.c_str (), filter)) continue;
+    if (list) { printf ("%s\n", benchmark.name.c_str ()); continue; }
+    results.push_back (run (benchmark, min_time));
+    print (results.back ());
+  }
+  if (json && !write_json (results, json, min_time)) {
+    fprintf (stderr, "micro: error: can not write '%s'\n", json);
+    return 1;
+  }
+  return 0;
+}
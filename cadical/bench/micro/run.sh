@@ -0,0 +1,71 @@
+#!/bin/sh
+
+#--------------------------------------------------------------------------#
+
+die () {
+  cecho "${HIDE}bench/micro/run.sh:${NORMAL} ${BAD}error:${NORMAL} $*"
+  exit 1
+}
+
+msg () {
+  cecho "${HIDE}bench/micro/run.sh:${NORMAL} $*"
+}
+
+for dir in . .. ../..
+do
+  [ -f $dir/scripts/colors.sh ] || continue
+  . $dir/scripts/colors.sh || exit 1
+  break
+done
+
+#--------------------------------------------------------------------------#
+
+[ -d ../bench -a -d ../bench/micro ] || \
+die "needs to be called from a top-level sub-directory of CaDiCaL"
+
+[ x"$CADICALBUILD" = x ] && CADICALBUILD="../build"
+
+[ -f "$CADICALBUILD/makefile" ] || \
+  die "can not find '$CADICALBUILD/makefile' (run 'configure' first)"
+
+cecho -n "$HILITE"
+cecho "---------------------------------------------------------"
+cecho "micro benchmarks in '$CADICALBUILD'"
+cecho "---------------------------------------------------------"
+cecho -n "$NORMAL"
+
+make -C $CADICALBUILD libcadical.a
+res=$?
+[ $res = 0 ] || exit $res
+
+#--------------------------------------------------------------------------#
+
+# The benchmarks use internal data structures, thus have to be compiled
+# with the same flags as the library.  Otherwise for instance 'LOGGING'
+# might change the layout of 'Internal'.
+
+makefile=$CADICALBUILD/makefile
+
+CXX=`grep '^CXX=' "$makefile"|sed -e 's,CXX=,,'`
+CXXFLAGS=`grep '^CXXFLAGS=' "$makefile"|sed -e 's,CXXFLAGS=,,'`
+
+case "$CXXFLAGS" in
+  *-DNDEBUG*) ;;
+  *) msg "${BAD}warning:${NORMAL} benchmarking build with assertions";;
+esac
+
+msg "using CXX=$CXX"
+msg "using CXXFLAGS=$CXXFLAGS"
+
+export CADICALBUILD
+
+name=$CADICALBUILD/bench-micro
+cecho "$CXX $CXXFLAGS -o $name ../bench/micro/micro.cpp -L$CADICALBUILD -lcadical"
+$CXX $CXXFLAGS -o $name ../bench/micro/micro.cpp -L$CADICALBUILD -lcadical || \
+  die "compilation failed"
+
+# Results are written to 'bench-micro.json' in the build directory unless
+# another '--json=<path>' is given, which then takes precedence.
+
+cecho "$name --json=$name.json $*"
+exec $name --json=$name.json $*
@@ -0,0 +1,78 @@
+#!/bin/sh
+
+#--------------------------------------------------------------------------#
+
+die () {
+  cecho "${HIDE}bench/solve/run.sh:${NORMAL} ${BAD}error:${NORMAL} $*"
+  exit 1
+}
+
+msg () {
+  cecho "${HIDE}bench/solve/run.sh:${NORMAL} $*"
+}
+
+for dir in . .. ../..
+do
+  [ -f $dir/scripts/colors.sh ] || continue
+  . $dir/scripts/colors.sh || exit 1
+  break
+done
+
+#--------------------------------------------------------------------------#
+
+[ -d ../bench -a -d ../bench/solve ] || \
+die "needs to be called from a top-level sub-directory of CaDiCaL"
+
+[ x"$CADICALBUILD" = x ] && CADICALBUILD="../build"
+
+[ -f "$CADICALBUILD/makefile" ] || \
+  die "can not find '$CADICALBUILD/makefile' (run 'configure' first)"
+
+cecho -n "$HILITE"
+cecho "---------------------------------------------------------"
+cecho "end-to-end benchmarks in '$CADICALBUILD'"
+cecho "---------------------------------------------------------"
+cecho -n "$NORMAL"
+
+make -C $CADICALBUILD libcadical.a
+res=$?
+[ $res = 0 ] || exit $res
+
+#--------------------------------------------------------------------------#
+
+# The benchmarks only use the API but are compiled with the same flags as
+# the library anyhow, since the statistics depend on the build.
+
+makefile=$CADICALBUILD/makefile
+
+CXX=`grep '^CXX=' "$makefile"|sed -e 's,CXX=,,'`
+CXXFLAGS=`grep '^CXXFLAGS=' "$makefile"|sed -e 's,CXXFLAGS=,,'`
+
+case "$CXXFLAGS" in
+  *-DNDEBUG*) ;;
+  *) msg "${BAD}warning:${NORMAL} benchmarking build with assertions";;
+esac
+
+msg "using CXX=$CXX"
+msg "using CXXFLAGS=$CXXFLAGS"
+
+export CADICALBUILD
+
+name=$CADICALBUILD/bench-solve
+cecho "$CXX $CXXFLAGS -o $name ../bench/solve/solve.cpp -L$CADICALBUILD -lcadical"
+$CXX $CXXFLAGS -o $name ../bench/solve/solve.cpp -L$CADICALBUILD -lcadical || \
+  die "compilation failed"
+
+# Results are written to 'bench-solve.csv' and 'bench-solve.json' in the
+# build directory unless other paths are given, which take precedence.  The
+# CSV files of two builds can be compared with '--compare'.
+
+case " $* " in
+  *" --compare "*)
+    cecho "$name $*"
+    exec $name $*
+    ;;
+esac
+
+cecho "$name --csv=$name.csv --json=$name.json $*"
+exec $name --csv=$name.csv --json=$name.json $*
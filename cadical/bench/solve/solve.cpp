@@ -0,0 +1,388 @@
+// End-to-end benchmarks solving generated instances through the API.  Each
+// run is executed in its own forked process to isolate the peak memory
+// usage of runs and to survive crashing runs.
+
+#include "../../src/cadical.hpp"
+#include "../families.hpp"
+
+#include <chrono>
+#include <cinttypes>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+}
+
+using namespace std;
+using namespace CaDiCaL;
+using namespace Families;
+
+/*------------------------------------------------------------------------*/
+
+static const char * usage =
+"usage: solve [ <option> ... ] [ <instance> ... ]\n"
+"   or: solve [ --threshold=<percent> ] --compare <old> <new>\n"
+"\n"
+"where '<option>' is one of the following\n"
+"\n"
+"  -h                    print this command line option summary\n"
+"  --config=<name>       solver configuration (default 'default')\n"
+"  --set=<opt>=<val>     set solver option for all runs\n"
+"  --time-limit=<sec>    time limit per run (default 60 seconds)\n"
+"  --repeat=<n>          repeat runs and keep the fastest (default 1)\n"
+"  --csv=<path>          write results as CSV to '<path>'\n"
+"  --json=<path>         write results as JSON to '<path>'\n"
+"\n"
+"Configurations and options can be given multiple times.  Each instance\n"
+"is solved with each configuration.  Instances are specified as\n"
+"'<family>:<size>' where '<family>' is one of the following\n"
+"\n"
+"  rand3, rand4, rand5   random k-SAT at threshold with '<size>' vars\n"
+"  ph                    pigeon hole with '<size>' holes\n"
+"  prime                 factoring a prime with '<size>' bit factors\n"
+"  factor                factoring a semiprime with '<size>' bit factors\n"
+"  sqrt                  square root of a square with '<size>' bits\n"
+"  add                   adder commutativity miter with '<size>' bits\n"
+"\n"
+"The second form compares two CSV files produced by the first form and\n"
+"flags runs which became slower by more than the threshold (default 10%)\n"
+"as well as runs which are not solved anymore or give different results.\n"
+"Then the exit code is non-zero.\n"
+;
+
+static const char * defaults[] = {
+  "rand3:200", "rand3:250", "rand4:80", "rand5:50", "ph:9", "ph:10",
+  "prime:16", "factor:16", "sqrt:28", "add:512", 0
+};
+
+/*------------------------------------------------------------------------*/
+
+struct Run {
+  string instance;
+  string config;
+  int status;                   // 10, 20, 0 = unknown, -1 = crashed
+  double time;                  // wall clock seconds of 'solve'
+  int64_t conflicts;
+  int64_t decisions;
+  int64_t propagations;
+  uint64_t memory;              // peak resident set size in bytes
+  double conflicts_per_second () const {
+    return time ? conflicts / time : 0;
+  }
+  double propagations_per_second () const {
+    return time ? propagations / time : 0;
+  }
+};
+
+// Sent from the child to the parent process through a pipe.
+
+struct Measurement {
+  int status;
+  double time;
+  int64_t conflicts, decisions, propagations;
+  uint64_t memory;
+};
+
+struct Options {
+  vector<string> configs;
+  vector<pair<string,int>> settings;
+  double time_limit;
+  int repeat;
+  Options () : time_limit (60), repeat (1) { }
+};
+
+static void die (const char * fmt, const char * arg = "") {
+  fputs ("solve: error: ", stderr);
+  fprintf (stderr, fmt, arg);
+  fputc ('\n', stderr);
+  exit (1);
+}
+
+/*------------------------------------------------------------------------*/
+
+struct Deadline : Terminator {
+  chrono::steady_clock::time_point end;
+  Deadline (double seconds) :
+    end (chrono::steady_clock::now () +
+         chrono::duration_cast<chrono::steady_clock::duration> (
+           chrono::duration<double> (seconds))) { }
+  bool terminate () { return chrono::steady_clock::now () > end; }
+};
+
+struct Counters : StatisticsIterator {
+  int64_t conflicts = 0, decisions = 0, propagations = 0;
+  bool counter (const char * name, int64_t value) {
+    if (!strcmp (name, "conflicts")) conflicts = value;
+    else if (!strcmp (name, "decisions")) decisions = value;
+    else if (!strncmp (name, "propagations.", 13)) propagations += value;
+    return true;
+  }
+  bool time (const char *, double) { return true; }
+};
+
+// Runs in the child process.  Generating and adding the instance is not
+// included in the measured time.
+
+static Measurement measure (const string & instance, const string & config,
+                            const Options & options) {
+  Measurement res;
+  memset (&res, 0, sizeof res);
+  Clauses clauses;
+  if (!generate (instance, clauses))
+    die ("invalid instance '%s'", instance.c_str ());
+  Solver solver;
+  if (!solver.configure (config.c_str ()))
+    die ("invalid configuration '%s'", config.c_str ());
+  for (const auto & setting : options.settings)
+    if (!solver.set (setting.first.c_str (), setting.second))
+      die ("invalid option '%s'", setting.first.c_str ());
+  for (const auto & clause : clauses) {
+    for (const auto & lit : clause)
+      solver.add (lit);
+    solver.add (0);
+  }
+  clauses.clear ();
+  Deadline deadline (options.time_limit);
+  solver.connect_terminator (&deadline);
+  const auto start = chrono::steady_clock::now ();
+  res.status = solver.solve ();
+  chrono::duration<double> delta = chrono::steady_clock::now () - start;
+  res.time = delta.count ();
+  Counters counters;
+  solver.traverse_statistics (counters);
+  res.conflicts = counters.conflicts;
+  res.decisions = counters.decisions;
+  res.propagations = counters.propagations;
+  struct rusage usage;
+  if (!getrusage (RUSAGE_SELF, &usage))
+    res.memory = (uint64_t) usage.ru_maxrss << 10;
+  return res;
+}
+
+static Run run (const string & instance, const string & config,
+                const Options & options) {
+  Run res { instance, config, -1, 0, 0, 0, 0, 0 };
+  int fds[2];
+  if (pipe (fds)) die ("can not create pipe");
+  fflush (stdout);
+  fflush (stderr);
+  const pid_t pid = fork ();
+  if (pid < 0) die ("can not fork");
+  if (!pid) {
+    close (fds[0]);
+    Measurement m = measure (instance, config, options);
+    const ssize_t bytes = sizeof m;
+    const int status = write (fds[1], &m, bytes) == bytes ? 0 : 1;
+    close (fds[1]);
+    _exit (status);
+  }
+  close (fds[1]);
+  Measurement m;
+  const ssize_t bytes = sizeof m;
+  const bool received = read (fds[0], &m, bytes) == bytes;
+  close (fds[0]);
+  int status;
+  waitpid (pid, &status, 0);
+  if (!received || !WIFEXITED (status) || WEXITSTATUS (status)) return res;
+  res.status = m.status;
+  res.time = m.time;
+  res.conflicts = m.conflicts;
+  res.decisions = m.decisions;
+  res.propagations = m.propagations;
+  res.memory = m.memory;
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+static void print_header () {
+  printf ("%-12s %-8s %6s %9s %10s %10s %10s %8s\n",
+    "instance", "config", "status", "seconds", "conflicts",
+    "confl/s", "props/s", "MB");
+}
+
+static void print (const Run & r) {
+  printf ("%-12s %-8s %6d %9.2f %10" PRId64 " %10.0f %10.0f %8.1f\n",
+    r.instance.c_str (), r.config.c_str (), r.status, r.time, r.conflicts,
+    r.conflicts_per_second (), r.propagations_per_second (),
+    r.memory / (double) (1 << 20));
+  fflush (stdout);
+}
+
+static const char * csv_header =
+  "instance,config,status,time,conflicts,decisions,propagations,"
+  "conflicts_per_second,propagations_per_second,memory";
+
+static bool write_csv (const vector<Run> & runs, const char * path) {
+  FILE * file = fopen (path, "w");
+  if (!file) return false;
+  fprintf (file, "%s\n", csv_header);
+  for (const auto & r : runs)
+    fprintf (file, "%s,%s,%d,%.6f,%" PRId64 ",%" PRId64 ",%" PRId64
+      ",%.3f,%.3f,%" PRIu64 "\n",
+      r.instance.c_str (), r.config.c_str (), r.status, r.time,
+      r.conflicts, r.decisions, r.propagations,
+      r.conflicts_per_second (), r.propagations_per_second (), r.memory);
+  return !fclose (file);
+}
+
+static bool write_json (const vector<Run> & runs, const char * path) {
+  FILE * file = fopen (path, "w");
+  if (!file) return false;
+  const time_t now = time (0);
+  char date[64];
+  strftime (date, sizeof date, "%Y-%m-%dT%H:%M:%S", localtime (&now));
+  fprintf (file, "{\n  \"context\": {\n");
+  fprintf (file, "    \"date\": \"%s\",\n", date);
+  fprintf (file, "    \"library\": \"CaDiCaL %s\"\n", Solver::version ());
+  fprintf (file, "  },\n  \"runs\": [");
+  for (size_t i = 0; i < runs.size (); i++) {
+    const Run & r = runs[i];
+    fprintf (file, "%s\n    {\n", i ? "," : "");
+    fprintf (file, "      \"instance\": \"%s\",\n", r.instance.c_str ());
+    fprintf (file, "      \"config\": \"%s\",\n", r.config.c_str ());
+    fprintf (file, "      \"status\": %d,\n", r.status);
+    fprintf (file, "      \"time\": %.6f,\n", r.time);
+    fprintf (file, "      \"conflicts\": %" PRId64 ",\n", r.conflicts);
+    fprintf (file, "      \"decisions\": %" PRId64 ",\n", r.decisions);
+    fprintf (file, "      \"propagations\": %" PRId64 ",\n",
+      r.propagations);
+    fprintf (file, "      \"conflicts_per_second\": %.3f,\n",
+      r.conflicts_per_second ());
+    fprintf (file, "      \"propagations_per_second\": %.3f,\n",
+      r.propagations_per_second ());
+    fprintf (file, "      \"memory\": %" PRIu64 "\n    }", r.memory);
+  }
+  fprintf (file, "\n  ]\n}\n");
+  return !fclose (file);
+}
+
+/*------------------------------------------------------------------------*/
+
+static vector<Run> read_csv (const char * path) {
+  FILE * file = fopen (path, "r");
+  if (!file) die ("can not read '%s'", path);
+  vector<Run> res;
+  char line[1024];
+  if (!fgets (line, sizeof line, file) ||
+      strncmp (line, csv_header, strlen (csv_header)))
+    die ("invalid header in '%s'", path);
+  while (fgets (line, sizeof line, file)) {
+    char instance[256], config[256];
+    Run r;
+    if (sscanf (line, "%255[^,],%255[^,],%d,%lf,%" SCNd64 ",%" SCNd64
+                ",%" SCNd64 ",%*f,%*f,%" SCNu64,
+                instance, config, &r.status, &r.time, &r.conflicts,
+                &r.decisions, &r.propagations, &r.memory) != 8)
+      die ("invalid line in '%s'", path);
+    r.instance = instance;
+    r.config = config;
+    res.push_back (r);
+  }
+  fclose (file);
+  return res;
+}
+
+// Times below 'noise' seconds are too short to be compared reliably.
+
+static int compare (const char * old_path, const char * new_path,
+                    double threshold) {
+  const double noise = 0.05;
+  map<pair<string,string>, Run> old_runs;
+  for (const auto & r : read_csv (old_path))
+    old_runs[{r.instance, r.config}] = r;
+  int regressions = 0;
+  printf ("%-12s %-8s %9s %9s %8s %10s %10s  %s\n",
+    "instance", "config", "old", "new", "change",
+    "old confl", "new confl", "verdict");
+  for (const auto & n : read_csv (new_path)) {
+    auto it = old_runs.find ({n.instance, n.config});
+    if (it == old_runs.end ()) continue;
+    const Run & o = it->second;
+    const double change = o.time ? 100 * (n.time - o.time) / o.time : 0;
+    const char * verdict = "";
+    if (o.status > 0 && n.status > 0 && o.status != n.status)
+      verdict = "DIFFERENT RESULT", regressions++;
+    else if (o.status > 0 && n.status <= 0)
+      verdict = "UNSOLVED", regressions++;
+    else if (n.status > 0 && o.status <= 0)
+      verdict = "solved";
+    else if (n.time - o.time > noise && change > threshold)
+      verdict = "SLOWER", regressions++;
+    else if (o.time - n.time > noise && -change > threshold)
+      verdict = "faster";
+    printf ("%-12s %-8s %9.2f %9.2f %7.1f%% %10" PRId64 " %10" PRId64
+      "  %s\n",
+      n.instance.c_str (), n.config.c_str (), o.time, n.time, change,
+      o.conflicts, n.conflicts, verdict);
+  }
+  printf ("found %d regressions\n", regressions);
+  return regressions ? 1 : 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+int main (int argc, char ** argv) {
+  Options options;
+  vector<string> instances;
+  const char * csv = 0, * json = 0;
+  const char * compared[2] = { 0, 0 };
+  double threshold = 10;
+  bool comparing = false;
+  for (int i = 1; i < argc; i++) {
+    const char * arg = argv[i];
+    if (!strcmp (arg, "-h")) { fputs (usage, stdout); return 0; }
+    else if (!strncmp (arg, "--config=", 9))
+      options.configs.push_back (arg + 9);
+    else if (!strncmp (arg, "--set=", 6)) {
+      const char * eq = strchr (arg + 6, '=');
+      if (!eq) die ("expected '--set=<opt>=<val>' in '%s'", arg);
+      options.settings.push_back ({string (arg + 6, eq), atoi (eq + 1)});
+    } else if (!strncmp (arg, "--time-limit=", 13))
+      options.time_limit = atof (arg + 13);
+    else if (!strncmp (arg, "--repeat=", 9))
+      options.repeat = atoi (arg + 9);
+    else if (!strncmp (arg, "--csv=", 6)) csv = arg + 6;
+    else if (!strncmp (arg, "--json=", 7)) json = arg + 7;
+    else if (!strncmp (arg, "--threshold=", 12))
+      threshold = atof (arg + 12);
+    else if (!strcmp (arg, "--compare")) {
+      if (i + 2 >= argc) die ("'--compare' requires two files");
+      compared[0] = argv[++i];
+      compared[1] = argv[++i];
+      comparing = true;
+    } else if (arg[0] == '-') die ("invalid option '%s' (try '-h')", arg);
+    else instances.push_back (arg);
+  }
+  if (comparing) return compare (compared[0], compared[1], threshold);
+  if (options.repeat < 1) die ("invalid number of repetitions");
+  if (options.configs.empty ()) options.configs.push_back ("default");
+  if (instances.empty ())
+    for (const char ** p = defaults; *p; p++)
+      instances.push_back (*p);
+  for (const auto & instance : instances)
+    if (!valid (instance))
+      die ("invalid instance '%s'", instance.c_str ());
+  vector<Run> runs;
+  print_header ();
+  for (const auto & instance : instances)
+    for (const auto & config : options.configs) {
+      Run best = run (instance, config, options);
+      for (int i = 1; i < options.repeat; i++) {
+        Run r = run (instance, config, options);
+        if (r.status == best.status && r.time < best.time) best = r;
+      }
+      print (best);
+      runs.push_back (best);
+    }
+  if (csv && !write_csv (runs, csv)) die ("can not write '%s'", csv);
+  if (json && !write_json (runs, json)) die ("can not write '%s'", json);
+  return 0;
+}
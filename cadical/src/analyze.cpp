@@ -615,6 +615,7 @@ void Internal::analyze () {
   //
   UPDATE_AVERAGE (averages.current.trail.fast, trail.size ());
   UPDATE_AVERAGE (averages.current.trail.slow, trail.size ());
+  histograms.trail.add (trail.size ());
 
   /*----------------------------------------------------------------------*/
 
@@ -735,9 +736,14 @@ void Internal::analyze () {
   // MiniSAT and described in our joint SAT'09 paper.
   //
   if (size > 1) {
-    if (opts.minimize) minimize_clause ();
+    if (opts.minimize) {
+      minimize_clause ();
+      const int removed = size - (int) clause.size ();
+      histograms.minimized.add (100 * removed / size);
+    }
     size = (int) clause.size ();
-    if (external->learner) external->export_learned_large_clause (clause);
+    if (external->learner && (!opts.exportglue || glue <= opts.exportglue))
+      external->export_learned_large_clause (clause);
   } else if (external->learner) external->export_learned_unit_clause (-uip);
 
   // Update actual size statistics.
@@ -745,6 +751,8 @@ void Internal::analyze () {
   stats.units    += (size == 1);
   stats.binaries += (size == 2);
   UPDATE_AVERAGE (averages.current.size, size);
+  histograms.size.add (size);
+  histograms.glue.add (glue);
 
   // Determine back-jump level, learn driving clause, backtrack and assign
   // flipped 1st UIP literal.
@@ -752,9 +760,12 @@ void Internal::analyze () {
   int jump;
   Clause * driving_clause = new_driving_clause (glue, jump);
   UPDATE_AVERAGE (averages.current.jump, jump);
+  histograms.jump.add (level - jump);
 
   int new_level = determine_actual_backtrack_level (jump);;
   UPDATE_AVERAGE (averages.current.level, new_level);
+  if (new_level > jump) histograms.chronological++;
+  else histograms.nonchronological++;
   backtrack (new_level);
 
   if (uip) search_assign_driving (-uip, driving_clause);
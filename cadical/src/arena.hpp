@@ -78,6 +78,12 @@ public:
     return from.start <= c && c < from.top;
   }
 
+  // Allocated memory of both spaces for memory accounting.
+  //
+  size_t bytes () const {
+    return (from.end - from.start) + (to.end - to.start);
+  }
+
   // Allocate that amount of memory in 'to' space.  This assumes the 'to'
   // space has been prepared to hold enough memory with 'prepare'.  Then
   // copy the memory pointed to by 'p' of size 'bytes'.  Note that it does
@@ -0,0 +1,109 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// As in 'Conquer' workers are only stopped by the 'done' flag, while the
+// external terminator is asked by the calling thread in 'solve'.
+
+struct BatchTerminator : public Terminator {
+  Batch * batch;
+  BatchTerminator (Batch * b) : batch (b) { }
+  bool terminate () { return batch->done; }
+};
+
+/*------------------------------------------------------------------------*/
+
+// The workers copy the formula of the calling solver sequentially, since
+// 'copy' traverses the clauses of the calling solver.
+
+Batch::Batch (Solver * solver, int threads, int share,
+              const vector<vector<int>> & q, Terminator * t) :
+  queries (q), terminator (t),
+  done (false), next (0), refuted (0), running (0),
+  results (q.size (), 0), cores (q.size ())
+{
+  assert (threads > 0);
+  vector<ClauseRing*> rings;
+  for (int idx = 0; idx < threads; idx++)
+    rings.push_back (new ClauseRing ());
+  for (int idx = 0; idx < threads; idx++) {
+    Worker worker;
+    worker.solver = new Solver ();
+    solver->copy (*worker.solver);
+    worker.solver->set ("quiet", 1);
+    worker.terminator = new BatchTerminator (this);
+    worker.ring = rings[idx];
+    worker.learner = new RingLearner (worker.ring, share);
+    worker.importer = new RingImporter (rings, idx);
+    worker.solver->connect_terminator (worker.terminator);
+    if (share) {
+      worker.solver->connect_learner (worker.learner);
+      worker.solver->connect_importer (worker.importer);
+    }
+    workers.push_back (worker);
+  }
+}
+
+Batch::~Batch () {
+  for (auto & worker : workers) {
+    delete worker.solver;
+    delete worker.terminator;
+    delete worker.learner;
+    delete worker.importer;
+    delete worker.ring;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+void Batch::work (int idx) {
+  Solver * solver = workers[idx].solver;
+  size_t i;
+  while (!done && (i = next++) < queries.size ()) {
+    const vector<int> & query = queries[i];
+    for (const auto & lit : query)
+      solver->assume (lit);
+    const int res = solver->solve ();
+    results[i] = res;
+    if (res != 20) continue;
+    refuted++;
+    for (const auto & lit : query)
+      if (solver->failed (lit))
+        cores[i].push_back (lit);
+  }
+}
+
+void Batch::solve () {
+
+  const int size = workers.size ();
+  running = size;
+
+  vector<thread> threads;
+  threads.reserve (size);
+  for (int idx = 0; idx < size; idx++)
+    threads.emplace_back ([this, idx] {
+      work (idx);
+      lock_guard<mutex> guard (lock);
+      running--;
+      finished.notify_all ();
+    });
+
+  // Waiting is bounded in order to ask the external terminator regularly.
+  {
+    unique_lock<mutex> guard (lock);
+    while (running) {
+      finished.wait_for (guard, chrono::milliseconds (10));
+      if (done || !terminator) continue;
+      guard.unlock ();
+      if (terminator->terminate ()) done = true;
+      guard.lock ();
+    }
+  }
+
+  for (auto & thread : threads)
+    thread.join ();
+}
+
+}
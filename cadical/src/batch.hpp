@@ -0,0 +1,64 @@
+#ifndef _batch_hpp_INCLUDED
+#define _batch_hpp_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+class Solver;
+class Terminator;
+class Learner;
+class Importer;
+struct ClauseRing;
+
+// State of a 'solve_many' call.  Each worker owns a copy of the calling
+// solver and repeatedly takes the next query through the atomic 'next'
+// index, thus faster workers solve more queries.  Short learned clauses
+// are exchanged through one ring per worker as in a portfolio.  Results
+// and cores are written by the worker which solved the query.  All workers
+// run in their own thread while the calling thread waits for them and asks
+// the external terminator.
+
+struct Batch {
+
+  struct Worker {
+    Solver * solver;
+    Terminator * terminator;
+    Learner * learner;
+    Importer * importer;
+    ClauseRing * ring;
+  };
+
+  vector<Worker> workers;
+  const vector<vector<int>> & queries;
+
+  Terminator * terminator;      // external terminator (or zero)
+
+  atomic<bool> done;            // forces workers to terminate
+  atomic<size_t> next;          // next query to solve
+  atomic<int64_t> refuted;      // unsatisfiable queries
+
+  mutex lock;                   // protects waiting for 'running'
+  condition_variable finished;  // notified when a worker finished
+  int running;                  // workers not finished yet
+
+  vector<int> results;
+  vector<vector<int>> cores;
+
+  Batch (Solver * solver, int threads, int share,
+         const vector<vector<int>> & queries, Terminator *);
+  ~Batch ();
+
+  void work (int idx);
+  void solve ();
+};
+
+}
+
+#endif
@@ -191,23 +191,37 @@ void Internal::block_schedule (Blocker & blocker)
   // filling the priority queue during pushing occurrences.  Filling the
   // schedule can not be fused with the previous loop (easily) since we
   // first have to initialize 'noccs' for both 'lit' and '-lit'.
+  //
+  // Marked literals of frozen variables and those marked to be skipped are
+  // counted as 'skipped' candidates (both stay marked).
 
   int skipped = 0;
 
-  for (auto idx : vars) {
-    if (!active (idx)) continue;
-    if (frozen (idx)) { skipped += 2; continue; }
+  sort_dirty (dirty.block);
+  const auto end = dirty.block.end ();
+  auto j = dirty.block.begin ();
+  for (auto i = j; i != end; i++) {
+    const int idx = *i;
+    if (!flags (idx).block) continue;
+    if (!active (idx)) { *j++ = idx; continue; }
+    if (frozen (idx)) {
+      skipped += marked_block (idx) + marked_block (-idx);
+      *j++ = idx;
+      continue;
+    }
     assert (!val (idx));
     for (int sign = -1; sign <= 1; sign += 2) {
       const int lit = sign * idx;
-      if (marked_skip (lit)) { skipped++; continue; }
       if (!marked_block (lit)) continue;
+      if (marked_skip (lit)) { skipped++; continue; }
       unmark_block (lit);
       LOG ("scheduling %d with %" PRId64 " positive and %" PRId64 " negative occurrences",
         lit, noccs (lit), noccs (-lit));
       blocker.schedule.push_back (vlit (lit));
     }
+    if (flags (idx).block) *j++ = idx;
   }
+  dirty.block.resize (j - dirty.block.begin ());
 
   PHASE ("block", stats.blockings,
     "scheduled %zd candidate literals %.2f%% (%d skipped %.2f%%)",
@@ -252,8 +266,8 @@ void Internal::block_pure_literal (Blocker & blocker, int lit)
     pured++;
   }
 
-  erase_vector (pos);
-  erase_vector (nos);
+  erase_occs (pos);
+  erase_occs (nos);
 
   mark_pure (lit);
   stats.blockpured++;
@@ -369,7 +383,7 @@ Internal::block_literal_with_one_negative_occ (Blocker & blocker, int lit)
     mark_garbage (c);
     j--;
   }
-  if (j == pos.begin ()) erase_vector (pos);
+  if (j == pos.begin ()) erase_occs (pos);
   else pos.resize (j - pos.begin ());
 
   stats.blocked += blocked;
@@ -421,7 +435,7 @@ size_t Internal::block_candidates (Blocker & blocker, int lit) {
     }
     if (l != eoc) blocker.candidates.push_back (c);
   }
-  if (j == pos.begin ()) erase_vector (pos);
+  if (j == pos.begin ()) erase_occs (pos);
   else pos.resize (j - pos.begin ());
 
   assert (pos.size () == (size_t) noccs (lit)); // Now also flushed.
@@ -504,7 +518,7 @@ void Internal::block_literal_with_at_least_two_negative_occs (
     if (c->garbage) j--;
     else if (c->size > max_size) max_size = c->size;
   }
-  if (j == nos.begin ()) erase_vector (nos);
+  if (j == nos.begin ()) erase_occs (nos);
   else nos.resize (j - nos.begin ());
 
   assert (nos.size () == (size_t) noccs (-lit));
@@ -671,6 +685,24 @@ bool Internal::block () {
   if (!stats.current.irredundant) return false;
   if (terminated_asynchronously ()) return false;
 
+  // Without any marked literal of an active and not frozen variable on
+  // the dirty work list nothing would be scheduled below.
+  //
+  sort_dirty (dirty.block);
+  bool candidates = false;
+  for (const auto & idx : dirty.block) {
+    if (!active (idx)) continue;
+    if (frozen (idx)) continue;
+    if (!(flags (idx).block & ~flags (idx).skip)) continue;
+    candidates = true;
+    break;
+  }
+  if (!candidates) {
+    LOG ("no blocking literal candidates");
+    stats.clean.block++;
+    return false;
+  }
+
   if (propagated < trail.size ()) {
     LOG ("need to propagate %zd units first", trail.size () - propagated);
     init_watches ();
@@ -221,6 +221,8 @@ void App::print_usage (bool all) {
 "\n"
 "  -o <output>    write simplified CNF in DIMACS format to file\n"
 "  -e <extend>    write reconstruction/extension stack to file\n"
+"  -E <events>    write event trace in Chrome trace JSON to file\n"
+"  --simplify     only preprocess (default '3' rounds, see '-P')\n"
 #ifdef LOGGING
 "  -l             enable logging messages (same as '--log')\n"
 #endif
@@ -412,12 +414,12 @@ int App::main (int argc, char ** argv) {
   const char * depth_specified = 0, * localsearch_specified = 0;
   bool proof_specified = false, dimacs_specified = false;
   int optimize = 0, preprocessing = 0, localsearch = 0;
-  const char * output_path = 0, * extension_path = 0;
+  const char * output_path = 0, * extension_path = 0, * events_path = 0;
   int conflict_limit = -1, decision_limit = -1;
   const char * conflict_limit_specified = 0;
   const char * decision_limit_specified = 0;
   const char * time_limit_specified = 0;
-  bool witness = true, less = false;
+  bool witness = true, less = false, simplify = false;
   const char * dimacs_name, * err;
 
   for (int i = 1; i < argc; i++) {
@@ -465,6 +467,14 @@ int App::main (int argc, char ** argv) {
       else if (!File::writable (argv[i]))
         APPERR ("extension file '%s' not writable", argv[i]);
       else extension_path = argv[i];
+    } else if (!strcmp (argv[i], "-E")) {
+      if (++i == argc) APPERR ("argument to '-E' missing");
+      else if (events_path)
+        APPERR ("multiple events file options '-E %s' and '-E %s'",
+          events_path, argv[i]);
+      else if (!File::writable (argv[i]))
+        APPERR ("events file '%s' not writable", argv[i]);
+      else events_path = argv[i];
     } else if (is_color_option (argv[i])) {
       tout.force_colors ();
       terr.force_colors ();
@@ -480,7 +490,10 @@ int App::main (int argc, char ** argv) {
              !strcmp (argv[i], "--witness=false") ||
              !strcmp (argv[i], "--witness=0"))
       witness = false;
-    else if (!strcmp (argv[i], "--less")) {             // EXPERIMENTAL!
+    else if (!strcmp (argv[i], "--simplify")) {
+      if (simplify) APPERR ("multiple '--simplify' options");
+      else simplify = true;
+    } else if (!strcmp (argv[i], "--less")) {             // EXPERIMENTAL!
       if (less) APPERR ("multiple '--less' options");
       else if (!isatty (1))
         APPERR ("'--less' without '<stdout>' connected to terminal");
@@ -633,6 +646,24 @@ int App::main (int argc, char ** argv) {
         multiple_specified, decision_limit_specified);
   }
 
+  if (simplify) {
+    if (localsearch_specified)
+      APPERR ("can not combine '--simplify' and '%s'",
+        localsearch_specified);
+    if (conflict_limit_specified)
+      APPERR ("can not combine '--simplify' and '-c %s'",
+        conflict_limit_specified);
+    if (decision_limit_specified)
+      APPERR ("can not combine '--simplify' and '-d %s'",
+        decision_limit_specified);
+    if (!preprocessing_specified) preprocessing = 3;
+  }
+
+  // Writing events without specifying the size of the ring buffer with
+  // '--events=<size>' keeps the last million events.
+  //
+  if (events_path && !get ("events")) set ("events", 1e6);
+
   /*----------------------------------------------------------------------*/
   // The '--less' option is not fully functional yet (it is also not
   // mentioned in the 'usage' message yet).  It only works as expected if
@@ -779,6 +810,10 @@ int App::main (int argc, char ** argv) {
 
   int res = 0;
 
+  if (incremental && simplify)
+    APPERR ("can not combine '--simplify' and incremental file '%s'",
+      dimacs_name);
+
   if (incremental) {
     bool reporting = get ("report") > 1 || get ("verbose") > 0;
     if (!reporting) set ("report", 0);
@@ -896,6 +931,9 @@ int App::main (int argc, char ** argv) {
 
     if (inconclusive && res == 20)
       res = 0;
+  } else if (simplify) {
+    root->section ("simplifying");
+    res = root->simplify (preprocessing);
   } else {
     root->section ("solving");
     res = root->solve ();
@@ -925,6 +963,14 @@ int App::main (int argc, char ** argv) {
     if (err) APPERR ("%s", err);
   }
 
+  if (events_path) {
+    root->section ("writing events");
+    root->message ("writing event trace to %s'%s'%s",
+      tout.green_code (), events_path, tout.normal_code ());
+    err = root->write_events (events_path);
+    if (err) APPERR ("%s", err);
+  }
+
   root->section ("result");
   if (res == 10) {
     printf ("s SATISFIABLE\n");
@@ -936,6 +982,7 @@ int App::main (int argc, char ** argv) {
   else printf ("c UNKNOWN\n");
   fflush (stdout);
   root->statistics ();
+  if (get ("hotspots")) root->hotspots ();
   if (multiple) root->prefix ("c ");
   root->resources ();
   root->section ("shutting down");
@@ -187,15 +187,23 @@ enum State
 class File;
 struct Internal;
 struct External;
+struct FormulaStore;
+struct Portfolio;
+struct ProcessPortfolio;
 
 /*------------------------------------------------------------------------*/
 
 // Forward declaration of call-back classes. See bottom of this file.
 
 class Learner;
+class Importer;
+class Progress;
 class Terminator;
 class ClauseIterator;
 class WitnessIterator;
+class StatisticsIterator;
+class HotspotIterator;
+class Formula;
 
 /*------------------------------------------------------------------------*/
 
@@ -284,6 +292,32 @@ public:
   void connect_learner (Learner * learner);
   void disconnect_learner ();
 
+  // Add call-back which allows to import clauses, e.g., learned by other
+  // solvers working on the same formula.  It is asked for clauses at
+  // restarts and they are added as redundant clauses.  Imported clauses
+  // have to be implied by the formula (without assumptions).  They are not
+  // traced in proofs and thus 'solve' and 'simplify' require that no
+  // importer is connected while checking or tracing proofs.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void connect_importer (Importer * importer);
+  void disconnect_importer ();
+
+  // Add call-back which is called while solving every 'interval'
+  // milliseconds of wall clock time with a snapshot of search metrics.
+  // It is called wherever the solver checks for asynchronous termination,
+  // thus also during preprocessing and inprocessing.  The first call
+  // happens at the first such check after connecting.  The call-back
+  // should be cheap and must not call back into the solver.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void connect_progress (Progress * progress, int interval = 1000);
+  void disconnect_progress ();
+
   // ====== END IPASIR =====================================================
 
   //------------------------------------------------------------------------
@@ -305,6 +339,49 @@ public:
 
   CubesWithStatus generate_cubes(int);
 
+  // Parallel cube-and-conquer.  The formula is split under the current
+  // assumptions into cubes by lookahead up to the given 'depth', where the
+  // first levels are split by this solver and the remaining levels by the
+  // workers in parallel.  Then 'threads' workers (zero means one per
+  // hardware thread) solve the cubes incrementally under assumptions and
+  // steal cubes from each other.  If the option 'conquerlimit' is non-zero
+  // cubes not solved within that many conflicts are split again on the
+  // fly.  The first satisfiable cube stops all workers.  Workers are
+  // copies of this solver, thus the solver has to be in a state in which
+  // 'copy' is allowed.  To make the result available through 'val' and
+  // 'failed' the solver finally solves the formula under the model found
+  // by a worker as assumptions, or, if all cubes are refuted, adds the
+  // implied negation of the assumptions as clause (the empty clause
+  // without assumptions) and solves again.  The connected terminator is
+  // only called from the calling thread.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN | SATISFIED | UNSATISFIED)
+  //
+  int solve_cubed (int depth, int threads = 0);
+
+  // Solve many independent queries, each given as a set of assumptions, on
+  // the current formula.  Queries are distributed dynamically to 'threads'
+  // copies of this solver (zero means one per hardware thread), which
+  // solve them incrementally one after the other.  Since assumptions are
+  // only decisions, all learned clauses are implied by the formula and thus
+  // learned clauses with at most 'batchshare' literals are shared between
+  // the copies.  The result of query 'i' is 'results[i]' (0, 10 or 20) and
+  // for unsatisfiable queries 'cores[i]' contains the failed assumptions.
+  // This solver itself is not changed (except for statistics) and the
+  // connected terminator is only called from the calling thread.
+  //
+  //   require (READY)
+  //   ensure (READY)
+  //
+  struct ResultsWithCores {
+    std::vector<int> results;
+    std::vector<std::vector<int>> cores;
+  };
+
+  ResultsWithCores solve_many (const std::vector<std::vector<int>> & queries,
+                               int threads = 0);
+
   void reset_assumptions();
 
   // Return the current state of the solver as defined above.
@@ -340,6 +417,21 @@ public:
   //
   void copy (Solver & other) const;
 
+  /*----------------------------------------------------------------------*/
+  // Add the clauses of a shared formula (see 'Formula' below) as if they
+  // were added one by one through 'add'.  Thus the solver still builds its
+  // own copy of the clauses for solving.  What is shared is the checking
+  // copy: if checking is enabled the solver keeps a reference to the
+  // formula instead of saving a private copy of its original clauses.
+  // Only one formula can be attached, but further clauses can still be
+  // added with 'add' and are kept separate from the attached ones.  No
+  // clause may be pending, i.e., started with 'add' but not terminated.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN)
+  //
+  void attach (const Formula &);
+
   /*----------------------------------------------------------------------*/
   // Variables are usually added and initialized implicitly whenever a
   // literal is used as an argument except for the functions 'val', 'fixed',
@@ -603,6 +695,74 @@ public:
   void statistics ();   // print statistics
   void resources ();    // print resource usage (time and memory)
 
+  // Traverse all statistics counters and profiled times with their names,
+  // e.g., 'conflicts' or 'propagations.search' and 'search', in a fixed
+  // order.  Process and real time are traversed first as times 'process'
+  // and 'real'.  The counters include the buckets of conflict analysis
+  // histograms named by their smallest value, e.g., 'histogram.glue.8'
+  // counts learned clauses with glue '8-15'.  Profiled times are only
+  // available if the library is not compiled with '-DQUIET' and only
+  // include profiles enabled by the 'profile' option.  This function can
+  // also be called from another thread while the solver is in 'solve' (or
+  // 'simplify').  Then it waits until the solver publishes a copy of all
+  // values at its next check for termination, which usually takes much
+  // less than a millisecond, but otherwise uses the previous copy after at
+  // most 100 milliseconds.  The return value is false if traversal is
+  // aborted early.
+  //
+  //   require (VALID | SOLVING)
+  //   ensure (VALID | SOLVING)
+  //
+  bool traverse_statistics (StatisticsIterator &) const;
+
+  // Traverse the number of bytes allocated by the major data structures
+  // as counters, i.e., 'arena', 'clauses', 'watches', 'occs', 'bins',
+  // 'vars', 'stacks', 'extension', 'original', 'external' and 'checker',
+  // followed by their sum 'total'.  This goes over all clauses and
+  // literals and thus can not be called while solving.  The return value
+  // is false if traversal is aborted early.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  bool traverse_memory (StatisticsIterator &) const;
+
+  // Write the same statistics as JSON object with the two members
+  // 'counters' and 'times' mapping names to values.  Returns zero if
+  // successful and otherwise an error message.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  const char * write_statistics (const char * path);
+
+  // Traverse the 'limit' clauses and variables with the most sampled
+  // propagation work if sampling is enabled with the 'hotspots' option,
+  // which gives the sampling interval.  Clauses are traversed first, by
+  // decreasing sum of watch visits and replacement search steps, then
+  // variables by decreasing number of propagations.  Only clauses still
+  // kept by the solver are traversed.  The return value is false if
+  // traversal is aborted early.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  bool traverse_hotspots (HotspotIterator &, int limit = 10) const;
+
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void hotspots (int limit = 10);       // print hottest clauses and variables
+
+  // Write the search and inprocessing phases recorded in the ring buffer
+  // enabled with the 'events' option in the Chrome trace event JSON
+  // format.  Returns zero if successful and otherwise an error message.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  const char * write_events (const char * path);
+
   //   require (VALID)
   //   ensure (VALID)
   //
@@ -759,6 +919,8 @@ private:
   friend class App;
   friend class Mobical;
   friend class Parser;
+  friend struct Portfolio;      // Reads conflicts in deterministic mode.
+  friend struct Conquer;        // Extends models found by lookahead.
 
   // Read solution in competition format for debugging and testing.
   //
@@ -812,6 +974,203 @@ private:
 
 /*========================================================================*/
 
+// A portfolio of differently configured solvers working on the same
+// formula in parallel threads.  Clauses and assumptions are only stored
+// once by the portfolio and each solver copies them on the next 'solve'
+// call in its own thread.  The first solver which determines the result
+// terminates all the others (through a connected terminator), and
+// afterwards the model or the failed assumptions are obtained from this
+// 'winner'.  Solver zero uses the default configuration.  The others use
+// the 'sat' and 'unsat' configurations, a negative initial phase as well
+// as different random seeds with shuffled variables.
+//
+// The state machine is simplified.  Clauses can be added at any time
+// outside of 'solve', while 'val' and 'failed' require a solver to have
+// determined the result of the last 'solve' call.
+
+class PortfolioSolver {
+
+public:
+
+  // The number of solvers is also the number of threads.  If it is zero
+  // (the default) the number of hardware threads is used.
+  //
+  PortfolioSolver (int solvers = 0);
+  ~PortfolioSolver ();
+
+  // Same semantics as for 'Solver'.
+  //
+  void add (int lit);
+  void assume (int lit);
+  int solve ();
+  int val (int lit);
+  bool failed (int lit);
+
+  // Can be called asynchronously (from another thread or signal handler)
+  // and then forces 'solve' to return '0'.
+  //
+  void terminate ();
+
+  // The connected terminator is only called from the thread calling
+  // 'solve', which waits for the solvers in short time intervals.
+  //
+  void connect_terminator (Terminator * terminator);
+  void disconnect_terminator ();
+
+  // Set option on all solvers, i.e., 'name' has to be a valid option
+  // which can still be set on all solvers.
+  //
+  //   require (!SOLVING)
+  //
+  bool set (const char * name, int val);
+
+  // Solvers share their learned clauses with at most 'size' literals and
+  // glue at most 'glue' (zero means all), which are imported by the other
+  // solvers at restarts.  The default is 'share (8, 2)' and 'share (0, 0)'
+  // disables sharing.  Each solver exports to its own lock-free ring
+  // buffer, which all others read without any synchronization.  Since
+  // imported clauses can not be checked, 'solve' requires that sharing and
+  // deterministic mode are disabled if the 'check' option is set.
+  //
+  //   require (!SOLVING)
+  //
+  void share (int size, int glue);
+
+  // In deterministic mode the solvers run in rounds of 'conflicts'
+  // conflicts each (zero disables this mode, which is the default).  A
+  // solver ends its round at the first restart after the round boundary
+  // and waits until all other solvers ended the round too.  The clauses
+  // learned in one round are only exchanged then and imported right away.
+  // The winner is the solver with the smallest index which determined the
+  // result in a round.  Thus for the same formula, options and number of
+  // solvers the result, the winner and the statistics of all solvers do
+  // not depend on thread scheduling (unless terminated).
+  //
+  //   require (!SOLVING)
+  //
+  void deterministic (int conflicts);
+
+  int vars ();                  // maximum variable index added so far
+  int size ();                  // number of solvers (and threads)
+  int status ();                // result of last 'solve' (or zero)
+
+  // The index of the solver which determined the last result or '-1' if
+  // the last 'solve' was terminated or no 'solve' was called yet.  After
+  // this the solver itself can be accessed for instance for statistics.
+  //
+  int winner ();
+  Solver * solver (int idx);
+
+private:
+
+  Portfolio * portfolio;        // Hiding threads from the API.
+};
+
+/*========================================================================*/
+
+// The same portfolio as above but each solver runs in its own forked worker
+// process instead of a thread.  This avoids sharing the address space with
+// the caller, e.g., a Python interpreter with its call-backs.  Learned
+// clauses and the termination flag are exchanged through a POSIX shared
+// memory segment, which only exists during 'solve'.  The formula is kept
+// in the calling process and inherited by the workers, which are forked
+// again for each 'solve' call.  Thus learned clauses are not kept across
+// incremental calls.  Connected terminators are only called in the calling
+// process.  Requires 'fork' and 'shm_open'.  Since the workers continue
+// after 'fork' without 'exec' and allocate memory, 'solve' requires the
+// calling process to be single-threaded, i.e., no other thread may be
+// running, not even one which is idle (threads of a 'PortfolioSolver' are
+// joined after its 'solve' returned and thus do not count).
+
+class ProcessPortfolioSolver {
+
+public:
+
+  // The number of worker processes (zero means hardware threads).
+  //
+  ProcessPortfolioSolver (int solvers = 0);
+  ~ProcessPortfolioSolver ();
+
+  // Same semantics as for 'PortfolioSolver'.
+  //
+  void add (int lit);
+  void assume (int lit);
+  int solve ();
+  int val (int lit);
+  bool failed (int lit);
+
+  void terminate ();
+  void connect_terminator (Terminator * terminator);
+  void disconnect_terminator ();
+
+  // Options are recorded and set in every worker after its configuration
+  // is diversified.  Returns false for invalid option names.
+  //
+  bool set (const char * name, int val);
+
+  // Same as for 'PortfolioSolver', including that sharing has to be
+  // disabled with 'share (0, 0)' if the 'check' option is set.
+  //
+  void share (int size, int glue);
+
+  int vars ();
+  int size ();
+  int status ();
+  int winner ();
+
+  // Describes why the last 'solve' failed, i.e., the shared memory segment
+  // could not be created, a worker could not be forked or a worker process
+  // crashed, and is zero otherwise.  In these cases 'solve' returns zero
+  // unless one of the remaining workers still determined the result.
+  //
+  const char * error ();
+
+private:
+
+  ProcessPortfolio * portfolio; // Hiding processes from the API.
+};
+
+/*========================================================================*/
+
+// Immutable store of original clauses shared between many solvers working
+// on the same base formula (see 'Solver::attach'), which serves as the
+// shared copy of the original clauses for checking.  Copies of a formula
+// share the same reference counted store, which is only released after the
+// last copy is destroyed.  Clauses are added as with 'Solver::add' as long
+// as the store is not shared.  A formula can also be written to a file in
+// a binary format, which later can be mapped read-only into memory with
+// 'map' (also by several processes at once).  Both return zero on success
+// and an error message otherwise.  Mapping replaces the current store.
+
+class Formula {
+
+public:
+
+  Formula ();
+  Formula (const Formula &);
+  Formula & operator = (const Formula &);
+  ~Formula ();
+
+  void add (int lit);
+
+  const char * write (const char * path) const;
+  const char * map (const char * path);
+
+  int vars () const;            // maximum variable index
+  int64_t clauses () const;     // number of clauses
+  size_t size () const;         // number of literals including zeroes
+
+  // Zero terminated clauses ('size' literals).
+  //
+  const int * literals () const;
+
+private:
+
+  FormulaStore * store;
+};
+
+/*========================================================================*/
+
 // Connected terminators are checked for termination regularly.  If the
 // 'terminate' function of the terminator returns true the solver is
 // terminated synchronously as soon it calls this function.
@@ -834,7 +1193,40 @@ public:
   virtual void learn (int lit) = 0;
 };
 
-/*------------------------------------------------------------------------*/
+// Connected importers are asked for clauses at restarts.  If 'import'
+// returns true it has filled 'clause' with the literals of a clause to
+// be imported and it is called again until it returns false.
+
+class Importer {
+public:
+  virtual ~Importer () { }
+  virtual bool import (std::vector<int> & clause) = 0;
+};
+
+// Snapshot of search metrics given to connected progress call-backs.
+
+struct ProgressMetrics {
+  double time;                  // real time since initialization
+  int64_t conflicts;
+  int64_t decisions;
+  int64_t propagations;         // during search
+  int64_t learned;              // learned clauses so far
+  int64_t redundant;            // current redundant clauses
+  int64_t irredundant;          // current irredundant clauses
+  int trail;                    // currently assigned literals
+  int level;                    // current decision level
+  double fast_glue;             // fast moving average of learned glue
+  double slow_glue;             // slow moving average of learned glue
+  bool stable;                  // in stable mode (otherwise focused)
+  const char * phase;           // 'search', 'elim', 'probe', ...
+  uint64_t memory;              // current resident set size in bytes
+};
+
+class Progress {
+public:
+  virtual ~Progress () { }
+  virtual void progress (const ProgressMetrics &) = 0;
+};
 
 /*------------------------------------------------------------------------*/
 
@@ -877,6 +1269,33 @@ public:
 
 /*------------------------------------------------------------------------*/
 
+// Allows to traverse statistics counters and times (in seconds) with their
+// names.  If one of the functions returns false traversal aborts early.
+
+class StatisticsIterator {
+public:
+  virtual ~StatisticsIterator () { }
+  virtual bool counter (const char * name, int64_t value) = 0;
+  virtual bool time (const char * name, double seconds) = 0;
+};
+
+/*------------------------------------------------------------------------*/
+
+// Allows to traverse clauses with their sampled number of watch visits and
+// replacement search steps and variables with their sampled number of
+// propagations.  If one of the functions returns false traversal aborts
+// early.
+
+class HotspotIterator {
+public:
+  virtual ~HotspotIterator () { }
+  virtual bool clause (const std::vector<int> &,
+                       int64_t visits, int64_t steps) = 0;
+  virtual bool variable (int idx, int64_t propagations) = 0;
+};
+
+/*------------------------------------------------------------------------*/
+
 }
 
 #endif
@@ -104,6 +104,29 @@ void Checker::enlarge_clauses () {
   size_clauses = new_size_clauses;
 }
 
+// Garbage clauses have their size reset and are thus only accounted by
+// their header until they are deleted in the next garbage collection.
+
+size_t Checker::bytes () const {
+  size_t res = 2 * size_vars * sizeof (signed char);
+  res += watchers.capacity () * sizeof (CheckerWatcher);
+  for (const auto & w : watchers)
+    res += w.capacity () * sizeof (CheckerWatch);
+  res += marks.capacity () * sizeof (signed char);
+  res += size_clauses * sizeof (CheckerClause *);
+  for (size_t i = 0; i < size_clauses; i++)
+    for (CheckerClause * c = clauses[i]; c; c = c->next)
+      res += sizeof (CheckerClause) + (c->size - 2) * sizeof (int);
+  for (CheckerClause * c = garbage; c; c = c->next)
+    res += sizeof (CheckerClause);
+  res += unsimplified.capacity () * sizeof (int);
+  res += simplified.capacity () * sizeof (int);
+  res += trail.capacity () * sizeof (int);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 bool Checker::clause_satisfied (CheckerClause * c) {
   for (unsigned i = 0; i < c->size; i++)
     if (val (c->literals[i]) > 0)
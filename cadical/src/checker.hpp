@@ -157,6 +157,7 @@ public:
   void delete_clause (const vector<int> &);
 
   void print_stats ();
+  size_t bytes () const;        // allocated memory for accounting
   void dump ();                 // for debugging purposes only
 };
 
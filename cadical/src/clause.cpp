@@ -234,6 +234,7 @@ void Internal::delete_clause (Clause * c) {
     if (proof && c->size == 2)
       proof->delete_clause (c);
   }
+  if (!hotspots.clauses.empty ()) forget_hotspot (c);
   deallocate_clause (c);
 }
 
@@ -56,9 +56,11 @@ void Internal::remove_falsified_literals (Clause * c) {
 // If there are new units (fixed variables) since the last garbage
 // collection we go over all clauses, mark satisfied ones as garbage and
 // flush falsified literals.  Otherwise if no new units have been generated
-// since the last garbage collection just skip this step.
+// since the last garbage collection just skip this step.  Variable
+// elimination further asks with 'elim' to mark the remaining variables of
+// shrunken irredundant clauses as elimination candidates.
 
-void Internal::mark_satisfied_clauses_as_garbage () {
+void Internal::mark_satisfied_clauses_as_garbage (bool elim) {
 
   if (last.collect.fixed >= stats.all.fixed) return;
   last.collect.fixed = stats.all.fixed;
@@ -69,7 +71,13 @@ void Internal::mark_satisfied_clauses_as_garbage () {
     if (c->garbage) continue;
     const int tmp = clause_contains_fixed_literal (c);
          if (tmp > 0) mark_garbage (c);
-    else if (tmp < 0) remove_falsified_literals (c);
+    else if (tmp < 0) {
+      remove_falsified_literals (c);
+      if (!elim || c->redundant) continue;
+      for (const auto & lit : *c)
+        if (active (lit))
+          mark_elim (lit);              // simulate unit propagation
+    }
   }
 }
 
@@ -262,6 +270,7 @@ void Internal::copy_clause (Clause * c) {
   char * q = arena.copy (p, c->bytes ());
   c->copy = (Clause *) q;
   c->moved = true;
+  if (!hotspots.clauses.empty ()) move_hotspot (c);
   LOG ("copied clause[%" PRId64 "] from %p to %p", c->id, c, c->copy);
 }
 
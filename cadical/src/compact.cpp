@@ -157,6 +157,7 @@ static signed char * ignore_clang_analyze_memory_leak_warning;
 void Internal::compact () {
 
   START (compact);
+  BEGIN_EVENT ("compact");
 
   assert (active () < max_var);
 
@@ -255,6 +256,11 @@ void Internal::compact () {
   if (!probes.empty ())
     mapper.map_flush_and_shrink_lits (probes);
 
+  mapper.map_flush_and_shrink_lits (dirty.elim);
+  mapper.map_flush_and_shrink_lits (dirty.subsume);
+  mapper.map_flush_and_shrink_lits (dirty.ternary);
+  mapper.map_flush_and_shrink_lits (dirty.block);
+
   /*======================================================================*/
   // In the third part we map stuff and also reallocate memory.
   /*======================================================================*/
@@ -331,6 +337,10 @@ void Internal::compact () {
   if (!wtab.empty ()) mapper.map2_vector (wtab);
   if (!otab.empty ()) mapper.map2_vector (otab);
   if (!big.empty ()) mapper.map2_vector (big);
+  if (!hotspots.variables.empty ()) {
+    hotspots.variables.resize (vsize, 0);
+    mapper.map_vector (hotspots.variables);
+  }
 
   /*======================================================================*/
   // In the fourth part we map the binary heap for scores.
@@ -409,6 +419,7 @@ void Internal::compact () {
     "new compact limit %" PRId64 " after %" PRId64 " conflicts",
     lim.compact, delta);
 
+  END_EVENT ("compact");
   STOP (compact);
 }
 
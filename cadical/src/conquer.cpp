@@ -0,0 +1,265 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Workers are only stopped by the 'done' flag.  The external terminator is
+// asked by the calling thread in 'solve' instead, since it might not be
+// thread safe and has to be asked even while all workers are idle or
+// solving cubes.
+
+struct ConquerTerminator : public Terminator {
+  Conquer * conquer;
+  ConquerTerminator (Conquer * c) : conquer (c) { }
+  bool terminate () { return conquer->done; }
+};
+
+/*------------------------------------------------------------------------*/
+
+// The workers copy the formula of the calling solver sequentially, since
+// 'copy' traverses the clauses of the calling solver.
+
+Conquer::Conquer (Solver * solver, int threads, int d, int l,
+                  Terminator * t) :
+  depth (d), limit (l), terminator (t),
+  done (false), busy (threads), running (0),
+  cubes (0), refuted (0), stolen (0), resplit (0),
+  res (0)
+{
+  assert (threads > 0);
+  assert (depth >= 0);
+  assert (limit >= 0);
+  for (int idx = 0; idx < threads; idx++) {
+    Worker * worker = new Worker ();
+    worker->solver = new Solver ();
+    solver->copy (*worker->solver);
+    worker->solver->set ("quiet", 1);
+    worker->terminator = new ConquerTerminator (this);
+    worker->solver->connect_terminator (worker->terminator);
+    workers.push_back (worker);
+  }
+}
+
+Conquer::~Conquer () {
+  for (auto worker : workers) {
+    delete worker->solver;
+    delete worker->terminator;
+    delete worker;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Record the model of the first satisfiable cube and stop all workers.
+
+void Conquer::satisfied (const vector<int> & assignment) {
+  lock_guard<mutex> guard (lock);
+  if (res) return;
+  res = 10;
+  model = assignment;
+  done = true;
+  wakeup ();
+}
+
+// Lookahead decides a cube without search if root level propagation and
+// preprocessing of the worker already refute its formula (status '20') or
+// no variable is left (status '10').  Then the result is recorded directly
+// instead of solving the cube again.  The solver of the worker is not in
+// the satisfied state then and thus its model is extended explicitly.
+
+bool Conquer::decided (int idx, int status) {
+  if (status == 20) { refuted++; return true; }
+  if (status != 10) return false;
+  Solver * solver = workers[idx]->solver;
+  External * external = solver->external;
+  external->extend ();
+  vector<int> assignment;
+  for (int lit = 1; lit <= external->max_var; lit++)
+    assignment.push_back (external->ival (lit));
+  satisfied (assignment);
+  return true;
+}
+
+// Split the given top-level cube further with the remaining depth.  If
+// lookahead refutes all its sub-cubes the cube itself is solved, which
+// then is cheap.
+
+void Conquer::generate (int idx, const vector<int> & prefix) {
+  Worker * worker = workers[idx];
+  Solver * solver = worker->solver;
+  vector<vector<int>> generated;
+  if (depth > 0) {
+    for (const auto & lit : prefix)
+      solver->assume (lit);
+    auto result = solver->generate_cubes (depth);
+    solver->reset_assumptions ();
+    if (result.status) {
+      cubes++;
+      decided (idx, result.status);
+      return;
+    }
+    generated = move (result.cubes);
+  }
+  if (generated.empty ()) generated.push_back (prefix);
+  cubes += generated.size ();
+  {
+    lock_guard<mutex> guard (worker->lock);
+    for (auto & cube : generated)
+      worker->cubes.push_back ({move (cube), 0});
+  }
+  wakeup ();
+}
+
+// Split a cube which reached its conflict limit into two sub-cubes.  If
+// lookahead does not find a split the cube is solved without limit unless
+// lookahead already decided it.
+
+void Conquer::split (int idx, Cube & cube) {
+  Worker * worker = workers[idx];
+  Solver * solver = worker->solver;
+  for (const auto & lit : cube.lits)
+    solver->assume (lit);
+  auto result = solver->generate_cubes (1);
+  solver->reset_assumptions ();
+  if (decided (idx, result.status)) return;
+  {
+    lock_guard<mutex> guard (worker->lock);
+    if (result.cubes.size () != 2) {
+      cube.splits = -1;
+      worker->cubes.push_front (move (cube));
+      return;
+    }
+    resplit++;
+    cubes += 2;
+    const int splits = cube.splits + 1;
+    worker->cubes.push_front ({move (result.cubes[0]), splits});
+    worker->cubes.push_back ({move (result.cubes[1]), splits});
+  }
+  wakeup ();
+}
+
+// Wake up idle workers after new cubes were queued, a worker became idle
+// or 'done' was set.  Taking 'sleeping' makes sure that a worker which
+// checked its condition before the change is already waiting.
+
+void Conquer::wakeup () {
+  { lock_guard<mutex> guard (sleeping); }
+  idle.notify_all ();
+}
+
+// Take the next cube from the front of the own queue or otherwise steal
+// one from the back of the queue of another worker.
+
+bool Conquer::take (int idx, Cube & cube) {
+  {
+    Worker * worker = workers[idx];
+    lock_guard<mutex> guard (worker->lock);
+    if (!worker->cubes.empty ()) {
+      cube = move (worker->cubes.front ());
+      worker->cubes.pop_front ();
+      return true;
+    }
+  }
+  const int size = workers.size ();
+  for (int i = 1; i < size; i++) {
+    Worker * other = workers[(idx + i) % size];
+    lock_guard<mutex> guard (other->lock);
+    if (other->cubes.empty ()) continue;
+    cube = move (other->cubes.back ());
+    other->cubes.pop_back ();
+    stolen++;
+    return true;
+  }
+  return false;
+}
+
+// Get the next cube to solve.  A worker is busy while it generates cubes
+// or holds a cube, since only then it can add new cubes to its queue.
+// Thus if no worker is busy and there is no cube left to take all cubes
+// have been solved.  Otherwise the worker sleeps until woken up.
+
+bool Conquer::next (int idx, Cube & cube) {
+  if (take (idx, cube)) return true;
+  busy--;
+  wakeup ();
+  unique_lock<mutex> guard (sleeping);
+  while (!done) {
+    const bool last = !busy;
+    if (take (idx, cube)) { busy++; return true; }
+    if (last) break;
+    idle.wait (guard);
+  }
+  return false;
+}
+
+// A worker first splits its share of the top-level cubes and then solves
+// cubes until all queues are empty and no other worker is busy.
+
+void Conquer::work (int idx, const vector<vector<int>> & roots) {
+  const size_t threads = workers.size ();
+  for (size_t i = idx; i < roots.size (); i += threads)
+    if (!done) generate (idx, roots[i]);
+  Solver * solver = workers[idx]->solver;
+  Cube cube;
+  while (!done && next (idx, cube)) {
+    int64_t conflicts = -1;
+    if (limit && cube.splits >= 0 && cube.splits < 32)
+      conflicts = (int64_t) limit << cube.splits;
+    if (conflicts > INT_MAX) conflicts = -1;
+    for (const auto & lit : cube.lits)
+      solver->assume (lit);
+    if (conflicts >= 0) solver->limit ("conflicts", conflicts);
+    const int tmp = solver->solve ();
+    if (!tmp && conflicts >= 0 && !done) split (idx, cube);
+    if (tmp == 20) refuted++;
+    if (tmp != 10) continue;
+    vector<int> assignment;
+    const int vars = solver->vars ();
+    for (int lit = 1; lit <= vars; lit++)
+      assignment.push_back (solver->val (lit));
+    satisfied (assignment);
+  }
+}
+
+// Returns '10' if one of the cubes is satisfiable, '20' if all cubes are
+// refuted and '0' if the external terminator stopped the workers.
+
+int Conquer::solve (const vector<vector<int>> & roots) {
+
+  const int size = workers.size ();
+  running = size;
+
+  vector<thread> threads;
+  threads.reserve (size);
+  for (int idx = 0; idx < size; idx++)
+    threads.emplace_back ([this, &roots, idx] {
+      work (idx, roots);
+      running--;
+      wakeup ();
+    });
+
+  // Waiting is bounded in order to ask the external terminator regularly,
+  // which is called without holding 'sleeping' since 'wakeup' needs it.
+  {
+    unique_lock<mutex> guard (sleeping);
+    while (running) {
+      idle.wait_for (guard, chrono::milliseconds (10));
+      if (done || !terminator) continue;
+      guard.unlock ();
+      if (terminator->terminate ()) {
+        done = true;
+        wakeup ();
+      }
+      guard.lock ();
+    }
+  }
+
+  for (auto & thread : threads)
+    thread.join ();
+
+  if (res) return res;
+  return done ? 0 : 20;
+}
+
+}
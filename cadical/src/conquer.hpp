@@ -0,0 +1,90 @@
+#ifndef _conquer_hpp_INCLUDED
+#define _conquer_hpp_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+class Solver;
+class Terminator;
+
+// State of a parallel cube-and-conquer run started by 'solve_cubed'.  The
+// calling solver splits the formula into a few top-level cubes, one or two
+// per worker, which are then split further by the workers in parallel on
+// their own copy of the formula.  The resulting cubes are put on the queue
+// of the worker which generated them.  Workers solve cubes incrementally
+// under assumptions, thus keep learned clauses across cubes.  They take
+// cubes from the front of their own queue and steal from the back of the
+// queue of other workers if their own queue is empty.  The first
+// satisfiable cube stops all workers.  All workers run in their own thread
+// while the calling thread waits for them and asks the external terminator.
+//
+// With a non-zero conflict 'limit' a cube which is not solved within its
+// conflict limit is split again by lookahead on the current (simplified)
+// formula of the worker.  The worker continues with the first sub-cube
+// while the second is put to the back of its queue to be stolen by idle
+// workers.  Each split doubles the conflict limit of the sub-cubes.
+
+struct Conquer {
+
+  struct Cube {
+    vector<int> lits;
+    int splits;                 // dynamic splits so far (-1 = no limit)
+  };
+
+  struct Worker {
+    Solver * solver;
+    Terminator * terminator;
+    deque<Cube> cubes;          // generated but not yet solved cubes
+    mutex lock;                 // protects 'cubes'
+    Worker () : solver (0), terminator (0) { }
+  };
+
+  vector<Worker*> workers;
+  int depth;                    // remaining depth for workers
+  int limit;                    // initial conflict limit per cube
+
+  Terminator * terminator;      // external terminator (or zero)
+
+  atomic<bool> done;            // forces workers to terminate
+  atomic<int> busy;             // workers generating or solving cubes
+  atomic<int> running;          // workers not finished yet
+
+  atomic<int64_t> cubes;        // generated cubes
+  atomic<int64_t> refuted;      // cubes shown to be unsatisfiable
+  atomic<int64_t> stolen;       // cubes solved by another worker
+  atomic<int64_t> resplit;      // cubes split after reaching their limit
+
+  mutex sleeping;               // protects waiting for cubes
+  condition_variable idle;      // idle workers wait for cubes or 'done'
+                                // and the calling thread for 'running'
+
+  mutex lock;                   // protects 'res' and 'model'
+  int res;                      // 10 if a cube is satisfiable
+  vector<int> model;            // of the first satisfiable cube
+
+  Conquer (Solver * solver, int threads, int depth, int limit,
+           Terminator *);
+  ~Conquer ();
+
+  void wakeup ();
+  void satisfied (const vector<int> & assignment);
+  bool decided (int idx, int status);
+  bool take (int idx, Cube & cube);
+  bool next (int idx, Cube & cube);
+  void generate (int idx, const vector<int> & prefix);
+  void split (int idx, Cube & cube);
+  void work (int idx, const vector<vector<int>> & roots);
+  int solve (const vector<vector<int>> & roots);
+};
+
+}
+
+#endif
@@ -94,6 +94,18 @@ do { \
     "invalid literal '%d'", (int)(LIT)); \
 } while (0)
 
+// Imported clauses can not be traced nor checked.  The proof is only
+// allocated when leaving the configuration state, which thus is checked
+// through the options too.
+
+#define REQUIRE_NO_IMPORT_WHILE_PROVING() \
+do { \
+  REQUIRE (!external->importer || \
+           !(internal->proof || \
+             (internal->opts.check && internal->opts.checkproof)), \
+    "can not import clauses while checking or tracing proofs"); \
+} while (0)
+
 /*------------------------------------------------------------------------*/
 #else // NCONTRACTS
 /*------------------------------------------------------------------------*/
@@ -104,6 +116,7 @@ do { \
 #define REQUIRE_READY_STATE() do { } while (0)
 #define REQUIRE_VALID_OR_SOLVING_STATE() do { } while (0)
 #define REQUIRE_VALID_LIT(...) do { } while (0)
+#define REQUIRE_NO_IMPORT_WHILE_PROVING() do { } while (0)
 
 /*------------------------------------------------------------------------*/
 #endif
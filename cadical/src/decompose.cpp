@@ -16,32 +16,17 @@ struct DFS {
   DFS () : idx (0), min (0) { }
 };
 
-// This performs one round of Tarjan's algorithm, e.g., equivalent literal
-// detection and substitution, on the whole formula.  We might want to
-// repeat it since its application might produce new binary clauses or
-// units.  Such units might even result in an empty clause.
+// This performs Tarjan's algorithm sequentially on the whole binary
+// implication graph and sets the representative 'reprs' for all active
+// literals.  If both a literal and its negation end up in the same SCC the
+// empty clause is learned.
 
-bool Internal::decompose_round () {
-
-  if (!opts.decompose) return false;
-  if (unsat) return false;
-  if (terminated_asynchronously ()) return false;
-
-  assert (!level);
-
-  START_SIMPLIFIER (decompose, DECOMP);
-
-  stats.decompositions++;
+void Internal::decompose_sequentially (int * reprs,
+                                       int & non_trivial_sccs,
+                                       int & substituted) {
 
   const size_t size_dfs = 2*(1 + (size_t) max_var);
   DFS * dfs = new DFS[size_dfs];
-  int * reprs = new int[size_dfs];
-  clear_n (reprs, size_dfs);
-
-  int non_trivial_sccs = 0, substituted = 0;
-#ifndef QUIET
-  int before = active ();
-#endif
   unsigned dfs_idx = 0;
 
   vector<int> work;                     // depth first search working stack
@@ -186,8 +171,377 @@ bool Internal::decompose_round () {
   erase_vector (work);
   erase_vector (scc);
   delete [] dfs;
+}
+
+/*------------------------------------------------------------------------*/
+
+// For huge formulas the depth first search above is rather slow, since it
+// jumps around in memory through the watch lists of all literals.  With
+// 'decomposethreads' larger than one we use the following alternative,
+// which first takes a snapshot of the binary implication graph in
+// compressed sparse row (CSR) format, i.e., the implied literals of all
+// literals are stored consecutively in one array.  This snapshot is then
+// shared (read-only) by all threads and decomposed in three steps.
+//
+// First we trim trivial SCCs.  A literal without any (not yet trimmed)
+// successor or without any predecessor can not be part of a non-trivial
+// SCC.  Since the binary implication graph is closed under contraposition
+// the predecessors of a literal are the negations of the successors of its
+// negation and further the SCC of the negation of a literal consists of
+// the negations of the literals in the SCC of the literal.  Thus we can
+// trim variables instead of literals.  Trimming usually removes the vast
+// majority of variables in the first few rounds and we stop as soon a
+// round does not trim at least one percent of the remaining variables.
+//
+// Second, the remaining literals are partitioned into weakly connected
+// components with a lock-free union-find data structure, where roots are
+// always linked to the root with the smaller literal index.
+//
+// Third, these components are independent and thus are decomposed with
+// Tarjan's algorithm in parallel.  Threads pick the next component
+// dynamically (largest first).  Each literal belongs to exactly one
+// component and thus all threads write to disjoint parts of 'dfs' and
+// 'reprs'.
+//
+// Since the SCCs are unique and the representative is still the literal
+// with the smallest variable index in its SCC (or the literal itself if it
+// is frozen), the result is exactly the same as in the sequential version
+// independent of the number of threads and their scheduling.
+//
+// The function returns 'false' without touching 'reprs' if the snapshot
+// can not be represented with 32-bit offsets.  Then the caller falls back
+// to the sequential version.
+
+bool Internal::decompose_in_parallel (int * reprs,
+                                      int & non_trivial_sccs,
+                                      int & substituted) {
+
+  const int threads = opts.decomposethreads;
+  assert (threads > 1);
+
+  const size_t size_lits = 2*(1 + (size_t) max_var);
+
+  // Take the CSR snapshot of the binary implication graph in two passes.
+  // The first counts the binary watches (implied literals) of each literal
+  // and then after computing the offsets the second pass copies them.
+
+  vector<unsigned> offsets (size_lits + 1, 0);
+
+  parallel_for (threads, size_lits - 2,
+    [&] (size_t begin, size_t end, int) {
+      for (size_t i = begin; i < end; i++) {
+        const unsigned u = i + 2;
+        const int lit = u2i (u);
+        unsigned count = 0;
+        if (active (lit))
+          for (const auto & w : watches (-lit))
+            if (w.binary () && active (w.blit))
+              count++;
+        offsets[u + 1] = count;
+      }
+    });
+
+  size_t edges = 0;
+  for (size_t u = 0; u < size_lits; u++) {
+    edges += offsets[u + 1];
+    if (edges >= UINT_MAX) {
+      LOG ("too many binary watches for parallel decomposition");
+      return false;
+    }
+    offsets[u + 1] = edges;
+  }
+
+  vector<unsigned> implied (edges);
+
+  parallel_for (threads, size_lits - 2,
+    [&] (size_t begin, size_t end, int) {
+      for (size_t i = begin; i < end; i++) {
+        const unsigned u = i + 2;
+        const int lit = u2i (u);
+        if (!active (lit)) continue;
+        unsigned pos = offsets[u];
+        for (const auto & w : watches (-lit))
+          if (w.binary () && active (w.blit))
+            implied[pos++] = vlit (w.blit);
+        assert (pos == offsets[u + 1]);
+      }
+    });
+
+  // Untrimmed variables are considered 'alive'.  They are read and written
+  // concurrently during trimming and thus use (relaxed) atomics.
+
+  vector<atomic<char>> alive (1 + (size_t) max_var);
+  size_t remaining = 0;
+  alive[0].store (0, memory_order_relaxed);
+  for (auto idx : vars) {
+    const bool tmp = active (idx);
+    alive[idx].store (tmp, memory_order_relaxed);
+    remaining += tmp;
+  }
+
+  auto is_alive = [&] (unsigned u) {
+    return alive[u/2].load (memory_order_relaxed);
+  };
+
+  auto has_alive_successor = [&] (unsigned u) {
+    const unsigned * const end = implied.data () + offsets[u + 1];
+    for (const unsigned * p = implied.data () + offsets[u]; p != end; p++)
+      if (*p/2 != u/2 && is_alive (*p)) return true;
+    return false;
+  };
+
+  vector<size_t> trimmed (threads);
+#ifndef QUIET
+  size_t trimming_rounds = 0, trimmed_variables = 0;
+#endif
+  for (;;) {
+    parallel_for (threads, max_var,
+      [&] (size_t begin, size_t end, int thread) {
+        size_t count = 0;
+        for (size_t i = begin; i < end; i++) {
+          const unsigned idx = i + 1;
+          if (!alive[idx].load (memory_order_relaxed)) continue;
+          if (has_alive_successor (2*idx) &&
+              has_alive_successor (2*idx + 1)) continue;
+          alive[idx].store (0, memory_order_relaxed);
+          count++;
+        }
+        trimmed[thread] = count;
+      });
+    size_t round = 0;
+    for (const auto & count : trimmed) round += count;
+    assert (round <= remaining);
+    remaining -= round;
+#ifndef QUIET
+    trimming_rounds++;
+    trimmed_variables += round;
+#endif
+    if (!round || 100 * round < remaining) break;
+  }
+
+  PHASE ("decompose", stats.decompositions,
+    "trimmed %zd variables in %zd rounds (%zd remain) using %d threads",
+    trimmed_variables, trimming_rounds, remaining, threads);
+
+  // Partition remaining literals into weakly connected components.
+
+  vector<atomic<unsigned>> parents (size_lits);
+  for (size_t u = 0; u < size_lits; u++)
+    parents[u].store (u, memory_order_relaxed);
+
+  auto find = [&] (unsigned u) {
+    for (;;) {
+      unsigned parent = parents[u].load (memory_order_relaxed);
+      if (parent == u) return u;
+      const unsigned grand = parents[parent].load (memory_order_relaxed);
+      if (grand != parent)                              // path halving
+        parents[u].compare_exchange_weak (parent, grand,
+                                          memory_order_relaxed);
+      u = grand;
+    }
+  };
+
+  parallel_for (threads, size_lits - 2,
+    [&] (size_t begin, size_t end, int) {
+      for (size_t i = begin; i < end; i++) {
+        const unsigned u = i + 2;
+        if (!is_alive (u)) continue;
+        const unsigned * const begin = implied.data () + offsets[u];
+        const unsigned * const stop = implied.data () + offsets[u + 1];
+        for (const unsigned * p = begin; p != stop; p++) {
+          if (!is_alive (*p)) continue;
+          unsigned a = u, b = *p;
+          for (;;) {
+            a = find (a), b = find (b);
+            if (a == b) break;
+            if (a < b) swap (a, b);
+            if (parents[a].compare_exchange_strong (a, b,
+                  memory_order_relaxed)) break;
+          }
+        }
+      }
+    });
+
+  // Sort the alive literals by component (counting sort) such that the
+  // members of each component are consecutive and ordered by index.
+
+  vector<unsigned> roots, start (size_lits + 1, 0);
+  for (size_t u = 2; u < size_lits; u++) {
+    if (!is_alive (u)) continue;
+    const unsigned root = find (u);
+    parents[u].store (root, memory_order_relaxed);
+    if (root == u) roots.push_back (u);
+    start[root + 1]++;
+  }
+  for (size_t u = 0; u < size_lits; u++)
+    start[u + 1] += start[u];
+  vector<unsigned> members (start[size_lits]);
+  {
+    vector<unsigned> pos (start.begin (), start.end () - 1);
+    for (size_t u = 2; u < size_lits; u++)
+      if (is_alive (u))
+        members[pos[parents[u].load (memory_order_relaxed)]++] = u;
+  }
+  erase_vector (parents);
+
+  auto component_size = [&] (unsigned root) {
+    return start[root + 1] - start[root];
+  };
+  stable_sort (roots.begin (), roots.end (),
+    [&] (unsigned a, unsigned b) {
+      return component_size (a) > component_size (b);
+    });
+
+  PHASE ("decompose", stats.decompositions,
+    "found %zd weakly connected components with %zd literals",
+    roots.size (), members.size ());
+
+  // Trimmed active literals are their own representative.
+
+  for (auto idx : vars) {
+    if (!active (idx) || alive[idx].load (memory_order_relaxed)) continue;
+    reprs[vlit (idx)] = idx;
+    reprs[vlit (-idx)] = -idx;
+  }
+
+  // Finally run Tarjan's algorithm on each component in parallel.
+
+  DFS * dfs = new DFS[size_lits];
+  atomic<size_t> next (0);
+  atomic<bool> inconsistent (false);
+  vector<int> failed (threads, 0), sccs (threads, 0), substs (threads, 0);
+
+  parallel_run (threads, [&] (int thread) {
+
+    vector<unsigned> work, scc;
+    unsigned dfs_idx = 0;
+
+    for (;;) {
+      if (inconsistent.load (memory_order_relaxed)) break;
+      const size_t k = next++;
+      if (k >= roots.size ()) break;
+      const unsigned root = roots[k];
+
+      for (unsigned r = start[root]; r != start[root + 1]; r++) {
+        if (dfs[members[r]].min == TRAVERSED) continue;
+        assert (work.empty ());
+        assert (scc.empty ());
+        work.push_back (members[r]);
+        while (!work.empty ()) {
+          const unsigned parent = work.back ();
+          DFS & parent_dfs = dfs[parent];
+          if (parent_dfs.min == TRAVERSED) { work.pop_back (); continue; }
+          const unsigned * const begin = implied.data () + offsets[parent];
+          const unsigned * const end = implied.data () + offsets[parent + 1];
+          if (parent_dfs.idx) {                         // post-fix
+            work.pop_back ();
+            unsigned new_min = parent_dfs.min;
+            for (const unsigned * p = begin; p != end; p++) {
+              if (!is_alive (*p)) continue;
+              const DFS & child_dfs = dfs[*p];
+              if (new_min > child_dfs.min) new_min = child_dfs.min;
+            }
+            if (parent_dfs.idx == new_min) {            // entry to SCC
+              unsigned other, repr = parent;
+              int size = 0;
+              size_t j = scc.size ();
+              do {
+                assert (j > 0);
+                other = scc[--j];
+                if (other == (parent ^ 1)) {
+                  failed[thread] = u2i (parent);
+                  inconsistent = true;
+                  break;
+                }
+                if (other/2 < repr/2) repr = other;
+                size++;
+              } while (other != parent);
+              if (failed[thread]) break;
+              do {
+                assert (!scc.empty ());
+                other = scc.back ();
+                scc.pop_back ();
+                dfs[other].min = TRAVERSED;
+                const int lit = u2i (other);
+                if (frozen (lit)) reprs[other] = lit;
+                else {
+                  reprs[other] = u2i (repr);
+                  if (other != repr) substs[thread]++;
+                }
+              } while (other != parent);
+              if (size > 1) sccs[thread]++;
+            } else parent_dfs.min = new_min;
+          } else {                                      // pre-fix
+            dfs_idx++;
+            assert (dfs_idx < TRAVERSED);
+            parent_dfs.idx = parent_dfs.min = dfs_idx;
+            scc.push_back (parent);
+            for (const unsigned * p = begin; p != end; p++)
+              if (is_alive (*p) && !dfs[*p].idx)
+                work.push_back (*p);
+          }
+        }
+        if (failed[thread]) break;
+      }
+      if (failed[thread]) break;
+    }
+  });
+
+  delete [] dfs;
+
+  for (int i = 0; i < threads; i++) {
+    non_trivial_sccs += sccs[i];
+    substituted += substs[i];
+  }
+
+  // If both a literal and its negation are in the same SCC the formula is
+  // unsatisfiable.  To be independent of scheduling we pick the failing
+  // literal with the smallest index (for the unit added to the proof).
+
+  if (inconsistent) {
+    int lit = 0;
+    for (const auto & other : failed)
+      if (other && (!lit || abs (other) < abs (lit))) lit = other;
+    assert (lit);
+    LOG ("both %d and %d in one SCC", lit, -lit);
+    assign_unit (lit);
+    learn_empty_clause ();
+  }
+
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
 
-  // Only keep the representatives 'repr' mapping.
+// This performs one round of equivalent literal detection and
+// substitution on the whole formula.  We might want to repeat it since its
+// application might produce new binary clauses or units.  Such units might
+// even result in an empty clause.
+
+bool Internal::decompose_round () {
+
+  if (!opts.decompose) return false;
+  if (unsat) return false;
+  if (terminated_asynchronously ()) return false;
+
+  assert (!level);
+
+  START_SIMPLIFIER (decompose, DECOMP);
+
+  stats.decompositions++;
+
+  const size_t size_reprs = 2*(1 + (size_t) max_var);
+  int * reprs = new int[size_reprs];
+  clear_n (reprs, size_reprs);
+
+  int non_trivial_sccs = 0, substituted = 0;
+#ifndef QUIET
+  int before = active ();
+#endif
+
+  if (opts.decomposethreads < 2 ||
+      !decompose_in_parallel (reprs, non_trivial_sccs, substituted))
+    decompose_sequentially (reprs, non_trivial_sccs, substituted);
 
   PHASE ("decompose",
     stats.decompositions,
@@ -199,19 +553,42 @@ bool Internal::decompose_round () {
   vector<Clause*> postponed_garbage;
 
   // Now go over all clauses and find clause which contain literals that
-  // should be substituted by their representative.
-
-  size_t clauses_size = clauses.size (), garbage = 0, replaced = 0;
-  for (size_t i = 0; substituted && !unsat && i < clauses_size; i++) {
-    Clause * c = clauses[i];
-    if (c->garbage) continue;
-    int j, size = c->size;
-    for (j = 0; j < size; j++) {
-      const int lit = c->literals[j];
-      if (reprs [ vlit (lit) ] != lit) break;
+  // should be substituted by their representative.  This search has to
+  // visit all literals of all clauses but is read-only and thus is split
+  // among 'decomposethreads' threads.  Only the (usually few) clauses found
+  // are then actually rewritten (in the same order as sequentially).
+
+  const size_t clauses_size = clauses.size ();
+  vector<size_t> candidates;
+
+  if (substituted) {
+    const int threads = opts.decomposethreads;
+    vector<vector<size_t>> found (threads);
+    parallel_for (threads, clauses_size,
+      [&] (size_t begin, size_t end, int thread) {
+        vector<size_t> & res = found[thread];
+        for (size_t i = begin; i < end; i++) {
+          const Clause * c = clauses[i];
+          if (c->garbage) continue;
+          for (const auto & lit : *c) {
+            if (reprs [ vlit (lit) ] == lit) continue;
+            res.push_back (i);
+            break;
+          }
+        }
+      });
+    for (auto & res : found) {
+      candidates.insert (candidates.end (), res.begin (), res.end ());
+      erase_vector (res);
     }
+  }
 
-    if (j == size) continue;
+  size_t garbage = 0, replaced = 0;
+  for (const auto & i : candidates) {
+    if (unsat) break;
+    Clause * c = clauses[i];
+    assert (!c->garbage);
+    const int size = c->size;
 
     replaced++;
     LOG (c, "first substituted literal %d in", substituted);
@@ -310,7 +687,7 @@ bool Internal::decompose_round () {
     replaced, percent (replaced, clauses_size),
     garbage, percent (garbage, replaced));
 
-  erase_vector (scc);
+  erase_vector (candidates);
 
   // Propagate found units.
 
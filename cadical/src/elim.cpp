@@ -598,6 +598,31 @@ int Internal::elim_round (bool & completed) {
   assert (opts.elim);
   assert (!unsat);
 
+  // Flushing root level satisfied irredundant clauses ('mark_removed') and
+  // falsified literals (here with 'elim' set) marks all variables in those
+  // clauses as candidates.  Afterwards no clause contains an assigned
+  // literal, and if further no candidate is on the dirty work list, then
+  // this round would schedule nothing.  In this case we can skip it without
+  // connecting occurrences of all clauses.
+  //
+  mark_satisfied_clauses_as_garbage (true);
+  sort_dirty (dirty.elim);
+  bool candidates = false;
+  for (const auto & idx : dirty.elim) {
+    if (!active (idx)) continue;
+    if (frozen (idx)) continue;
+    if (!flags (idx).elim) continue;
+    candidates = true;
+    break;
+  }
+  if (!candidates) {
+    LOG ("no variable elimination candidates");
+    stats.clean.elim++;
+    last.elim.marked = stats.mark.elim;
+    completed = true;
+    return 0;
+  }
+
   START_SIMPLIFIER (elim, ELIM);
   stats.elimrounds++;
 
@@ -624,26 +649,15 @@ int Internal::elim_round (bool & completed) {
 
   init_noccs ();
 
-  // First compute the number of occurrences of each literal and at the same
-  // time mark satisfied clauses and update 'elim' flags of variables in
-  // clauses with root level assigned literals (both false and true).
+  // First compute the number of occurrences of each literal.  Root level
+  // satisfied clauses and falsified literals have already been flushed
+  // above, which also updated the 'elim' flags of their variables.
   //
   for (const auto & c : clauses) {
     if (c->garbage || c->redundant) continue;
-    bool satisfied = false, falsified = false;
     for (const auto & lit : *c) {
-      const signed char tmp = val (lit);
-      if (tmp > 0) satisfied = true;
-      else if (tmp < 0) falsified = true;
-      else assert (active (lit));
-    }
-    if (satisfied) mark_garbage (c);     // forces more precise counts
-    else {
-      for (const auto & lit : *c) {
-        if (!active (lit)) continue;
-        if (falsified) mark_elim (lit);  // simulate unit propagation
-        noccs (lit)++;
-      }
+      assert (active (lit));
+      noccs (lit)++;
     }
   }
 
@@ -656,14 +670,18 @@ int Internal::elim_round (bool & completed) {
   // the last time we ran bounded variable elimination, which in turned
   // triggered their 'elim' bit to be set.
   //
-  for (auto idx : vars) {
-    if (!active (idx)) continue;
-    if (frozen (idx)) continue;
+  sort_dirty (dirty.elim);
+  const auto end = dirty.elim.end ();
+  auto j = dirty.elim.begin ();
+  for (auto i = j; i != end; i++) {
+    const int idx = *i;
     if (!flags (idx).elim) continue;
+    if (!active (idx) || frozen (idx)) { *j++ = idx; continue; }
     flags (idx).elim = false;
     LOG ("scheduling %d for elimination initially", idx);
     schedule.push_back (idx);
   }
+  dirty.elim.resize (j - dirty.elim.begin ());
 
   schedule.shrink ();
 
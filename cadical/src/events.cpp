@@ -0,0 +1,54 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+void Internal::record_event (const char * name, char type) {
+  assert (opts.events > 0);
+  if (events.ring.empty ()) events.ring.resize (opts.events);
+  Event & e = events.ring[events.recorded++ % events.ring.size ()];
+  e.time = real_time ();
+  e.conflicts = stats.conflicts;
+  e.name = name;
+  e.type = type;
+}
+
+/*------------------------------------------------------------------------*/
+
+// If the ring buffer overflowed the oldest recorded events are lost and
+// the remaining events might start with the end of a phase for which the
+// beginning is lost.  These are skipped.  Phases not ended yet, e.g., if
+// the solver was terminated, are extended to the end of the trace by the
+// viewer.  Time stamps are given in microseconds.
+
+bool Internal::write_events (File * file) {
+  const uint64_t size = events.ring.size ();
+  const uint64_t end = events.recorded;
+  const uint64_t begin = end > size ? end - size : 0;
+  if (!file->put ("{\"traceEvents\":[")) return false;
+  char buffer[64];
+  int depth = 0;
+  bool first = true;
+  for (uint64_t i = begin; i < end; i++) {
+    const Event & e = events.ring[i % size];
+    if (e.type == 'E') {
+      if (!depth) continue;
+      depth--;
+    } else depth++;
+    if (!file->put (first ? "\n{\"name\":\"" : ",\n{\"name\":\"")) return false;
+    first = false;
+    if (!file->put (e.name)) return false;
+    if (!file->put ("\",\"cat\":\"cadical\",\"ph\":\"")) return false;
+    if (!file->put (e.type)) return false;
+    snprintf (buffer, sizeof buffer, "\",\"ts\":%.3f", 1e6 * e.time);
+    if (!file->put (buffer)) return false;
+    if (!file->put (",\"pid\":1,\"tid\":1,\"args\":{\"conflicts\":"))
+      return false;
+    if (!file->put (e.conflicts)) return false;
+    if (!file->put ("}}")) return false;
+  }
+  return file->put ("\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+}
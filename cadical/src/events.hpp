@@ -0,0 +1,50 @@
+#ifndef _events_hpp_INCLUDED
+#define _events_hpp_INCLUDED
+
+#include <cstdint>
+#include <vector>
+
+namespace CaDiCaL {
+
+// Optional recording of a time line of search and inprocessing phases
+// enabled with '--events=<size>', which keeps the last '<size>' events in
+// a ring buffer.  An event records the real time and the number of
+// conflicts when a phase begins or ends.  The recorded events can be
+// written in the Chrome trace event JSON format with 'write_events' and
+// viewed for instance with 'chrome://tracing' or 'ui.perfetto.dev'.
+//
+// If disabled recording costs one option check per phase.
+
+struct Event {
+  double time;                  // real time since initialization
+  int64_t conflicts;            // number of conflicts at this point
+  const char * name;            // static name of the phase
+  char type;                    // 'B' = begin and 'E' = end
+};
+
+struct Events {
+  std::vector<Event> ring;      // allocated when recording first event
+  uint64_t recorded;            // all events recorded so far
+  Events () : recorded (0) { }
+};
+
+}
+
+/*------------------------------------------------------------------------*/
+
+// Phases have to be properly nested, i.e., an 'END_EVENT' has to match the
+// last 'BEGIN_EVENT' which has not been ended yet.
+
+#define BEGIN_EVENT(NAME) \
+do { \
+  if (internal->opts.events) internal->record_event (NAME, 'B'); \
+} while (0)
+
+#define END_EVENT(NAME) \
+do { \
+  if (internal->opts.events) internal->record_event (NAME, 'E'); \
+} while (0)
+
+/*------------------------------------------------------------------------*/
+
+#endif
@@ -10,7 +10,11 @@ External::External (Internal * i)
   extended (false),
   terminator (0),
   learner (0),
+  importer (0),
+  progress (0),
+  progressint (0),
   solution (0),
+  base (0),
   vars (max_var)
 {
   assert (internal);
@@ -20,6 +24,7 @@ External::External (Internal * i)
 
 External::~External () {
   if (solution) delete [] solution;
+  if (base) delete base;
 }
 
 void External::enlarge (int new_max_var) {
@@ -138,6 +143,30 @@ void External::add (int elit) {
   internal->add_original_lit (ilit);
 }
 
+// The attached clauses are added to the internal solver as with 'add',
+// but without saving them in 'original', since checking can use the
+// attached formula instead, which thus is the shared checking copy.  The
+// solver still needs its own copy of the clauses for solving.  At least
+// all variables are initialized and the clause table is reserved up front
+// since their sizes are known, which avoids the slack and the peaks of
+// growing them while adding the clauses.
+
+void External::attach (const Formula & formula) {
+  assert (!base);
+  reset_extended ();
+  base = new Formula (formula);
+  const int * lits = formula.literals ();
+  const size_t size = formula.size ();
+  LOG ("attaching formula with %" PRId64 " clauses", formula.clauses ());
+  init (formula.vars ());
+  internal->clauses.reserve (internal->clauses.size () + formula.clauses ());
+  for (size_t i = 0; i < size; i++) {
+    const int elit = lits[i];
+    const int ilit = internalize (elit);
+    internal->add_original_lit (ilit);
+  }
+}
+
 void External::assume (int elit) {
   assert (elit);
   reset_extended ();
@@ -261,18 +290,13 @@ CaDiCaL::CubesWithStatus External::generate_cubes (int depth) {
   update_molten_literals ();
   reset_limits ();
   auto cubes = internal->generate_cubes (depth);
-  auto externalize = [this](int ilit) {
-    const int elit = ilit ? internal->externalize (ilit) : 0;
-    MSG ("lookahead internal %d external %d", ilit, elit);
-    return elit;
-  };
-  auto externalize_map = [this, externalize](std::vector<int> cube) {
-    MSG("Cube : ");
-    std::for_each(begin(cube), end(cube), externalize);
-  };
-    std::for_each(begin(cubes.cubes), end(cubes.cubes), externalize_map);
-
-    return cubes;
+  for (auto & cube : cubes.cubes)
+    for (auto & lit : cube) {
+      const int elit = internal->externalize (lit);
+      LOG ("lookahead internal %d external %d", lit, elit);
+      lit = elit;
+    }
+  return cubes;
 }
 
 /*------------------------------------------------------------------------*/
@@ -324,12 +348,26 @@ void External::check_assignment (int (External::*a)(int) const) {
       FATAL ("inconsistently assigned literals %d and %d", idx, -idx);
   }
 
-  // Then check that all (saved) original clauses are satisfied.
+  // Then check that all attached and (saved) original clauses are
+  // satisfied.
   //
-  bool satisfied = false;
-  const auto end = original.end ();
-  auto start = original.begin (), i = start;
   int64_t count = 0;
+  if (base) {
+    const int * lits = base->literals ();
+    check_satisfied (a, lits, lits + base->size (), count);
+  }
+  const int * lits = original.data ();
+  check_satisfied (a, lits, lits + original.size (), count);
+  VERBOSE (1,
+    "satisfying assignment checked on %" PRId64 " clauses",
+    count);
+}
+
+void External::check_satisfied (int (External::*a)(int) const,
+                                const int * start, const int * end,
+                                int64_t & count) {
+  bool satisfied = false;
+  const int * i = start;
   for (; i != end; i++) {
     int lit = *i;
     if (!lit) {
@@ -346,9 +384,6 @@ void External::check_assignment (int (External::*a)(int) const) {
       count++;
     } else if (!satisfied && (this->*a) (lit) > 0) satisfied = true;
   }
-  VERBOSE (1,
-    "satisfying assignment checked on %" PRId64 " clauses",
-    count);
 }
 
 /*------------------------------------------------------------------------*/
@@ -371,6 +406,7 @@ void External::check_assumptions_failing () {
 #ifdef LOGGING
   if (internal->opts.log) checker->set ("log", true);
 #endif
+  if (base) checker->attach (*base);
   for (const auto & lit : original)
     checker->add (lit);
   for (const auto & lit : assumptions) {
@@ -450,6 +486,12 @@ void External::copy_flags (External & other) const {
     const Flags & this_flags = this_ftab[abs (this_ilit)];
     Flags & other_flags = other_ftab[abs (other_ilit)];
     this_flags.copy (other_flags);
+    Dirty & dirty = other.internal->dirty;
+    const int idx = abs (other_ilit);
+    if (other_flags.elim) dirty.elim.push_back (idx);
+    if (other_flags.subsume) dirty.subsume.push_back (idx);
+    if (other_flags.ternary) dirty.ternary.push_back (idx);
+    if (other_flags.block) dirty.block.push_back (idx);
   }
 }
 
@@ -90,10 +90,21 @@ struct External {
   void export_learned_unit_clause (int ilit);
   void export_learned_large_clause (const vector<int> &);
 
+  // If there is an importer clauses are imported at restarts.
+
+  Importer * importer;
+
+  // If there is a progress call-back it is called every 'progressint'
+  // milliseconds wall clock time while solving.
+
+  Progress * progress;
+  int progressint;
+
   //----------------------------------------------------------------------//
 
   signed char * solution;     // Given solution checking for debugging.
   vector<int> original;       // Saved original formula for checking.
+  Formula * base;             // Attached checking copy (or zero).
 
   // If 'opts.checkfrozen' is set make sure that only literals are added
   // which were never completely molten before.  These molten literals are
@@ -250,6 +261,7 @@ struct External {
   // Proxies to IPASIR functions.
 
   void add (int elit);
+  void attach (const Formula &);
   void assume (int elit);
   int solve (bool preprocess_only);
 
@@ -329,6 +341,8 @@ struct External {
   }
 
   void check_assignment (int (External::*assignment) (int) const);
+  void check_satisfied (int (External::*assignment) (int) const,
+                        const int * begin, const int * end, int64_t & count);
 
   void check_satisfiable ();
   void check_unsatisfiable ();
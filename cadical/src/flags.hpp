@@ -1,6 +1,8 @@
 #ifndef _flags_hpp_INCLUDED
 #define _flags_hpp_INCLUDED
 
+#include <vector>
+
 namespace CaDiCaL {
 
 struct Flags {        // Variable flags.
@@ -70,6 +72,18 @@ struct Flags {        // Variable flags.
   }
 };
 
+// Work lists of variables for which one of the flags marked with '(*)'
+// was set.  A variable is pushed whenever its flag goes from false to
+// true (for 'block' if none of its two literal bits was set before).
+// Thus every marked variable is on its list, but lists can also contain
+// variables with already reset flags as well as duplicates.  This allows
+// simplifiers to find their candidates and to detect that there are none
+// without going over all variables or clauses.
+
+struct Dirty {
+  std::vector<int> elim, subsume, ternary, block;
+};
+
 }
 
 #endif
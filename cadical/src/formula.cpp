@@ -0,0 +1,135 @@
+#include "internal.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+FormulaStore::FormulaStore () :
+  references (1), mapped (0), bytes (0),
+  begin (0), size (0), max_var (0), clauses (0)
+{
+}
+
+FormulaStore::~FormulaStore () {
+  if (mapped) munmap (mapped, bytes);
+}
+
+void FormulaStore::add (int lit) {
+  assert (!mapped);
+  lits.push_back (lit);
+  begin = lits.data ();
+  size = lits.size ();
+  if (!lit) clauses++;
+  else if (abs (lit) > max_var) max_var = abs (lit);
+}
+
+// The header is checked to be consistent with the size of the file and
+// all literals are checked to be valid for the maximum variable in the
+// header before they can reach 'Solver::attach'.  This touches all pages
+// of the file once, but they are still shared between processes.
+
+const char * FormulaStore::map (const char * path) {
+  assert (!mapped);
+  assert (lits.empty ());
+  const int fd = open (path, O_RDONLY);
+  if (fd < 0) return "can not open formula file";
+  struct stat buf;
+  if (fstat (fd, &buf) || (size_t) buf.st_size < header) {
+    close (fd);
+    return "formula file too small";
+  }
+  const size_t file_bytes = buf.st_size;
+  void * ptr = mmap (0, file_bytes, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+  if (ptr == MAP_FAILED) return "can not map formula file";
+  const uint64_t * words = (const uint64_t *) ptr;
+  const uint64_t available = (file_bytes - header) / sizeof (int);
+  bool valid = words[0] == magic &&
+               words[1] <= available &&
+               file_bytes == header + words[1] * sizeof (int) &&
+               words[2] <= INT_MAX &&
+               words[3] <= words[1];
+  const int * file_lits = (const int *) ((const char *) ptr + header);
+  const int64_t file_max_var = valid ? words[2] : 0;
+  uint64_t zeroes = 0;
+  for (uint64_t i = 0; valid && i < words[1]; i++) {
+    const int lit = file_lits[i];
+    if (!lit) zeroes++;
+    else if (lit == INT_MIN || abs (lit) > file_max_var) valid = false;
+  }
+  if (valid && words[1] && file_lits[words[1] - 1]) valid = false;
+  if (valid && zeroes != words[3]) valid = false;
+  if (!valid) {
+    munmap (ptr, file_bytes);
+    return "invalid formula file";
+  }
+  mapped = ptr;
+  bytes = file_bytes;
+  begin = file_lits;
+  size = words[1];
+  max_var = words[2];
+  clauses = words[3];
+  return 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+Formula::Formula () : store (new FormulaStore ()) { }
+
+Formula::Formula (const Formula & other) : store (other.store) {
+  store->references++;
+}
+
+Formula & Formula::operator = (const Formula & other) {
+  if (store == other.store) return *this;
+  other.store->references++;
+  if (!--store->references) delete store;
+  store = other.store;
+  return *this;
+}
+
+Formula::~Formula () {
+  if (!--store->references) delete store;
+}
+
+void Formula::add (int lit) {
+  REQUIRE (lit != INT_MIN, "invalid literal '%d'", lit);
+  REQUIRE (!store->mapped, "can not add literal to mapped formula");
+  REQUIRE (store->references == 1, "can not add literal to shared formula");
+  store->add (lit);
+}
+
+const char * Formula::write (const char * path) const {
+  REQUIRE (!store->size || !store->begin[store->size-1],
+    "clause incomplete (terminating zero not added)");
+  FILE * file = fopen (path, "wb");
+  if (!file) return "can not open formula file for writing";
+  const uint64_t words[4] = {
+    FormulaStore::magic, store->size,
+    (uint64_t) store->max_var, (uint64_t) store->clauses
+  };
+  bool ok = fwrite (words, sizeof words, 1, file) == 1;
+  if (ok && store->size)
+    ok = fwrite (store->begin, sizeof (int), store->size, file) ==
+         store->size;
+  if (fclose (file)) ok = false;
+  return ok ? 0 : "writing formula file failed";
+}
+
+const char * Formula::map (const char * path) {
+  Formula mapped;
+  const char * err = mapped.store->map (path);
+  if (!err) *this = mapped;
+  return err;
+}
+
+int Formula::vars () const { return store->max_var; }
+int64_t Formula::clauses () const { return store->clauses; }
+size_t Formula::size () const { return store->size; }
+const int * Formula::literals () const { return store->begin; }
+
+}
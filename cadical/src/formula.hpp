@@ -0,0 +1,44 @@
+#ifndef _formula_hpp_INCLUDED
+#define _formula_hpp_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+// Reference counted storage of a 'Formula'.  The zero terminated clauses
+// are either owned in 'lits' while the formula is built or read-only
+// mapped from a file written by 'Formula::write'.  The file starts with a
+// header of four 64-bit words (magic number, number of literals including
+// the terminating zeroes, maximum variable and number of clauses) followed
+// by the literals as 32-bit integers in native byte order.
+
+struct FormulaStore {
+
+  static const uint64_t magic = 0x616c756d726f4643ull;   // "CFormula"
+  static const size_t header = 4 * sizeof (uint64_t);
+
+  atomic<unsigned> references;
+
+  vector<int> lits;             // if built through 'add'
+  void * mapped;                // if mapped (or zero)
+  size_t bytes;                 // of mapped file
+
+  const int * begin;
+  size_t size;                  // number of literals including zeroes
+  int max_var;
+  int64_t clauses;
+
+  FormulaStore ();
+  ~FormulaStore ();
+
+  void add (int lit);
+  const char * map (const char * path);
+};
+
+}
+
+#endif
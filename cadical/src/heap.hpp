@@ -185,6 +185,12 @@ public:
     shrink_vector (pos);
   }
 
+  // Allocated memory for memory accounting.
+  //
+  size_t bytes () const {
+    return (array.capacity () + pos.capacity ()) * sizeof (unsigned);
+  }
+
   // Standard iterators 'inherited' from 'vector'.
   //
   typedef typename vector<unsigned>::iterator iterator;
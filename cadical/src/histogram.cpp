@@ -0,0 +1,107 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+int64_t Histogram::count () const {
+  int64_t res = 0;
+  for (unsigned i = 0; i < size (); i++)
+    res += buckets[i];
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+#define HISTOGRAMS \
+HISTOGRAM(size, "learned clause size") \
+HISTOGRAM(glue, "learned clause glue") \
+HISTOGRAM(jump, "back-jump distance") \
+HISTOGRAM(trail, "trail length at conflict") \
+HISTOGRAM(minimized, "percentage of literals minimized")
+
+Histograms::Histograms () :
+  minimized (true), chronological (0), nonchronological (0)
+{
+  init_names ();
+}
+
+void Histograms::init_names () {
+  assert (names.empty ());
+#define HISTOGRAM(NAME,DESCRIPTION) \
+  for (unsigned i = 0; i < NAME.size (); i++) \
+    names.push_back ("histogram." #NAME "." + to_string (NAME.lower (i)));
+  HISTOGRAMS
+#undef HISTOGRAM
+}
+
+// Traverses all buckets, including empty ones, such that the set of names
+// is fixed, followed by the number of chronological and non-chronological
+// backtracks.
+
+bool Histograms::traverse (StatisticsIterator & it) const {
+  auto name = names.begin ();
+#define HISTOGRAM(NAME,DESCRIPTION) \
+  for (unsigned i = 0; i < NAME.size (); i++) \
+    if (!it.counter ((name++)->c_str (), NAME.buckets[i])) return false;
+  HISTOGRAMS
+#undef HISTOGRAM
+  assert (name == names.end ());
+  return
+    it.counter ("histogram.chronological", chronological) &&
+    it.counter ("histogram.nonchronological", nonchronological);
+}
+
+/*------------------------------------------------------------------------*/
+
+#ifndef QUIET
+
+static void print_histogram (Internal * internal, const Histogram & h,
+                             const char * description, bool & first) {
+  const int64_t total = h.count ();
+  if (!total) return;
+  if (first) first = false;
+  else MSG ("");
+  MSG ("%s (%" PRId64 " samples):", description, total);
+  for (unsigned i = 0; i < h.size (); i++) {
+    const int64_t count = h.buckets[i];
+    if (!count) continue;
+    const int64_t lower = h.lower (i);
+    char range[32];
+    if (i + 1 == h.size ())
+      snprintf (range, sizeof range, "%" PRId64 "-", lower);
+    else if (h.lower (i + 1) - 1 == lower)
+      snprintf (range, sizeof range, "%" PRId64, lower);
+    else
+      snprintf (range, sizeof range, "%" PRId64 "-%" PRId64,
+        lower, h.lower (i + 1) - 1);
+    const double p = percent (count, total);
+    const string bar (p / 2.5 + 0.5, '#');
+    MSG ("  %-13s %15" PRId64 "   %10.2f %%  %s%s%s",
+      range, count, p, tout.blue_code (), bar.c_str (), tout.normal_code ());
+  }
+}
+
+#endif
+
+void Histograms::print (Internal * internal) {
+#ifndef QUIET
+  if (!size.count () && !chronological && !nonchronological) return;
+  SECTION ("conflict analysis histograms");
+  bool first = true;
+#define HISTOGRAM(NAME,DESCRIPTION) \
+  print_histogram (internal, NAME, DESCRIPTION, first);
+  HISTOGRAMS
+#undef HISTOGRAM
+  const int64_t backtracks = chronological + nonchronological;
+  MSG ("");
+  MSG ("chronological:   %15" PRId64 "   %10.2f %%  of backtracks",
+    chronological, percent (chronological, backtracks));
+  MSG ("nonchronological:%15" PRId64 "   %10.2f %%  of backtracks",
+    nonchronological, percent (nonchronological, backtracks));
+#else
+  (void) internal;
+#endif
+}
+
+}
@@ -0,0 +1,84 @@
+#ifndef _histogram_hpp_INCLUDED
+#define _histogram_hpp_INCLUDED
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CaDiCaL {
+
+class StatisticsIterator;
+struct Internal;
+
+// Fixed bucket histograms giving a distributional view of conflict
+// analysis beyond the moving averages in 'averages.hpp'.  Updating a
+// histogram is only a few instructions, thus they are always maintained.
+//
+// Values up to seven have their own bucket and larger values are put into
+// buckets of exponentially increasing size, i.e., '8-15', '16-31' etc.,
+// except for percentages, which use ten buckets of ten percent and one for
+// exactly hundred percent.  Buckets are named by their smallest value.
+
+struct Histogram {
+
+  enum { BUCKETS = 32 };
+
+  bool percent;
+  int64_t buckets[BUCKETS];
+
+  Histogram (bool p = false) : percent (p) {
+    for (auto & b : buckets) b = 0;
+  }
+
+  static unsigned logarithmic (uint64_t value) {
+    if (value < 8) return value;
+    unsigned res = 5;                   // 'value' in '8-15' gives '8'
+    while (value >>= 1) res++;
+    return res < BUCKETS ? res : BUCKETS - 1;
+  }
+
+  unsigned bucket (int64_t value) const {
+    if (value < 0) value = 0;
+    if (percent) return value < 100 ? value / 10 : 10;
+    return logarithmic (value);
+  }
+
+  void add (int64_t value) { buckets[bucket (value)]++; }
+
+  unsigned size () const { return percent ? 11 : BUCKETS; }
+  int64_t lower (unsigned bucket) const {
+    if (percent) return 10 * bucket;
+    if (bucket < 8) return bucket;
+    return (int64_t) 1 << (bucket - 5);
+  }
+  int64_t count () const;
+};
+
+struct Histograms {
+
+  Histogram size;               // learned clause size after minimization
+  Histogram glue;               // learned clause glue
+  Histogram jump;               // back-jump distance 'level - jump'
+  Histogram trail;              // trail length at conflict
+  Histogram minimized;          // percentage removed by minimization
+
+  int64_t chronological;        // backtracking above the jump level
+  int64_t nonchronological;     // backtracking to the jump level
+
+  Histograms ();
+
+  bool traverse (StatisticsIterator &) const;
+  void print (Internal *);
+
+private:
+
+  // Persistent names of buckets, e.g., 'histogram.size.8', such that
+  // traversal does not need to allocate names (see 'traverse').
+
+  std::vector<std::string> names;
+  void init_names ();
+};
+
+}
+
+#endif
@@ -0,0 +1,144 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Called from 'propagate' if the propagated literal 'lit' is sampled.
+
+void Internal::sample_variable (int lit) {
+  assert (opts.hotspots);
+  hotspots.countdown = opts.hotspots;
+  const int idx = vidx (lit);
+  if ((size_t) idx >= hotspots.variables.size ())
+    hotspots.variables.resize (vsize, 0);
+  hotspots.variables[idx]++;
+}
+
+void Internal::sample_clause (Clause * c, int steps) {
+  assert (opts.hotspots);
+  Hotspot & h = hotspots.clauses[c];
+  h.visits++;
+  h.steps += steps;
+}
+
+// Keep the counters of clauses moved or deleted by the garbage collector.
+
+void Internal::move_hotspot (Clause * c) {
+  assert (c->moved);
+  auto it = hotspots.clauses.find (c);
+  if (it == hotspots.clauses.end ()) return;
+  const Hotspot h = it->second;
+  hotspots.clauses.erase (it);
+  hotspots.clauses[c->copy] = h;
+}
+
+void Internal::forget_hotspot (Clause * c) {
+  hotspots.clauses.erase (c);
+}
+
+/*------------------------------------------------------------------------*/
+
+// The work of a clause is the sum of its visits and search steps.
+
+struct hotspot_more_work {
+  bool operator () (const pair<Clause *, Hotspot> & a,
+                    const pair<Clause *, Hotspot> & b) const {
+    const int64_t s = a.second.visits + a.second.steps;
+    const int64_t t = b.second.visits + b.second.steps;
+    if (s != t) return s > t;
+    return a.second.visits > b.second.visits;
+  }
+};
+
+bool Internal::traverse_hotspots (HotspotIterator & it, int limit) {
+
+  vector<pair<Clause *, Hotspot>> clauses;
+  for (const auto & p : hotspots.clauses)
+    if (!p.first->garbage) clauses.push_back (p);
+  const size_t bound = min (clauses.size (), (size_t) limit);
+  partial_sort (clauses.begin (), clauses.begin () + bound, clauses.end (),
+                hotspot_more_work ());
+
+  vector<int> eclause;
+  for (size_t i = 0; i < bound; i++) {
+    const Clause * c = clauses[i].first;
+    eclause.clear ();
+    for (const auto & ilit : *c)
+      eclause.push_back (externalize (ilit));
+    const Hotspot & h = clauses[i].second;
+    if (!it.clause (eclause, h.visits, h.steps)) return false;
+  }
+
+  vector<int> variables;
+  for (size_t idx = 1; idx < hotspots.variables.size (); idx++)
+    if (hotspots.variables[idx]) variables.push_back (idx);
+  const size_t vbound = min (variables.size (), (size_t) limit);
+  const auto & counts = hotspots.variables;
+  partial_sort (variables.begin (), variables.begin () + vbound,
+                variables.end (), [&counts] (int a, int b) {
+                  if (counts[a] != counts[b]) return counts[a] > counts[b];
+                  return a < b;
+                });
+
+  for (size_t i = 0; i < vbound; i++) {
+    const int idx = variables[i];
+    if (!it.variable (abs (externalize (idx)), counts[idx])) return false;
+  }
+
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+#ifndef QUIET
+
+struct HotspotPrinter : public HotspotIterator {
+  Internal * internal;
+  int clauses, variables;
+  HotspotPrinter (Internal * i) : internal (i), clauses (0), variables (0) { }
+  bool clause (const vector<int> & c, int64_t visits, int64_t steps) {
+    if (!clauses++)
+      MSG ("%4s %12s %12s  %s", "rank", "visits", "steps", "clause");
+    string lits;
+    for (const auto & lit : c) {
+      lits += to_string (lit);
+      lits += ' ';
+    }
+    lits += '0';
+    MSG ("%4d %12" PRId64 " %12" PRId64 "  %s",
+      clauses, visits, steps, lits.c_str ());
+    return true;
+  }
+  bool variable (int idx, int64_t propagations) {
+    if (!variables++) {
+      if (clauses) MSG ();
+      MSG ("%4s %12s  %s", "rank", "propagations", "variable");
+    }
+    MSG ("%4d %12" PRId64 "  %d", variables, propagations, idx);
+    return true;
+  }
+};
+
+#endif
+
+void Internal::print_hotspots (int limit) {
+#ifndef QUIET
+  SECTION ("hotspots");
+  if (!opts.hotspots)
+    MSG ("sampling of hotspots disabled (use '--hotspots=<n>')");
+  else {
+    MSG ("sampled every %d propagated literal%s",
+      opts.hotspots, opts.hotspots == 1 ? "" : "s");
+    MSG ();
+    HotspotPrinter printer (this);
+    traverse_hotspots (printer, limit);
+    if (!printer.clauses && !printer.variables)
+      MSG ("no hotspots sampled");
+  }
+#else
+  (void) limit;
+#endif
+}
+
+}
@@ -0,0 +1,43 @@
+#ifndef _hotspots_hpp_INCLUDED
+#define _hotspots_hpp_INCLUDED
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace CaDiCaL {
+
+struct Clause;
+
+// Optional sampling of propagation work enabled with '--hotspots=<n>'.
+// Every 'n'-th literal propagated during search is sampled, i.e., the
+// variable is counted and every visited watch of a clause, which is not
+// skipped due to its blocking literal being satisfied, is counted as well
+// as the number of literals inspected while searching for a replacement
+// watch.  Counting all propagated literals ('n=1') is precise but might
+// almost double running time due to the hash table accesses below, while
+// with sampling intervals of '64' and more the overhead stays within a few
+// percent.
+//
+// The counters of clauses are kept in a hash table instead of the clause
+// to keep the size of clauses small if sampling is disabled.  They are
+// moved along with the clauses in the moving garbage collector and dropped
+// when clauses are deleted.  Thus only the counters of clauses still alive
+// are available.
+
+struct Hotspot {
+  int64_t visits;               // sampled watch visits
+  int64_t steps;                // sampled replacement search steps
+  Hotspot () : visits (0), steps (0) { }
+};
+
+struct Hotspots {
+  int countdown;                // propagated literals until next sample
+  std::unordered_map<Clause *, Hotspot> clauses;
+  std::vector<int64_t> variables;
+  Hotspots () : countdown (1) { }
+};
+
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Clauses given by a connected 'Importer' (see 'cadical.hpp'), e.g., from
+// other solvers working on the same formula, are imported at restarts.  As
+// soon the first clause is provided we backtrack to the root level, where
+// imported clauses are simplified by removing root level falsified
+// literals.  They are ignored if they are satisfied or contain variables
+// which are not active anymore (eliminated or substituted), since their
+// occurrence would otherwise have to be restored first.  The remaining
+// clauses are added as redundant clauses and units are propagated.
+
+bool Internal::import_clause (const vector<int> & eclause) {
+  assert (!level);
+  assert (clause.empty ());
+  bool skip = false;
+  for (const auto & elit : eclause) {
+    const int eidx = abs (elit);
+    if (!elit || elit == INT_MIN || eidx > external->max_var) {
+      skip = true;
+      break;
+    }
+    int ilit = external->e2i[eidx];
+    if (!ilit) { skip = true; break; }
+    if (elit < 0) ilit = -ilit;
+    const signed char tmp = val (ilit);
+    if (tmp > 0) { skip = true; break; }
+    if (tmp < 0) continue;
+    if (!active (ilit)) { skip = true; break; }
+    const signed char prev = marked (ilit);
+    if (prev > 0) continue;
+    if (prev < 0) { skip = true; break; }
+    mark (ilit);
+    clause.push_back (ilit);
+  }
+  for (const auto & lit : clause)
+    unmark (lit);
+  if (skip) {
+    LOG (eclause, "skipping imported external");
+    clause.clear ();
+    return false;
+  }
+  external->check_learned_clause ();
+  const size_t size = clause.size ();
+  if (!size) {
+    LOG ("imported empty clause");
+    learn_empty_clause ();
+  } else if (size == 1) {
+    LOG ("imported unit %d", clause[0]);
+    assign_unit (clause[0]);
+    stats.imported.units++;
+  } else {
+    Clause * c = new_clause (true, size - 1);
+    LOG (c, "imported");
+    watch_clause (c);
+  }
+  clause.clear ();
+  return true;
+}
+
+void Internal::import_clauses () {
+
+  assert (external->importer);
+  assert (!proof);  // Imported clauses can not be traced.
+
+  bool backtracked = false;
+  vector<int> eclause;
+
+  while (!unsat &&
+         !terminated_asynchronously () &&
+         external->importer->import (eclause)) {
+    if (!backtracked) {
+      backtrack ();
+      backtracked = true;
+    }
+    if (import_clause (eclause)) stats.imported.clauses++;
+    else stats.imported.skipped++;
+    eclause.clear ();
+  }
+
+  if (!backtracked || unsat) return;
+
+  if (!propagate ()) {
+    LOG ("propagating imported units results in empty clause");
+    learn_empty_clause ();
+  }
+}
+
+}
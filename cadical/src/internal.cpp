@@ -165,6 +165,12 @@ void Internal::init_vars (int new_max_var) {
   max_var = new_max_var;
   init_queue (old_max_var, new_max_var);
   init_scores (old_max_var, new_max_var);
+  for (int idx = old_max_var + 1; idx <= new_max_var; idx++) {
+    dirty.elim.push_back (idx);         // All flags are set initially
+    dirty.subsume.push_back (idx);      // (see 'Flags::Flags') and thus
+    dirty.ternary.push_back (idx);      // new variables have to be put
+    dirty.block.push_back (idx);        // on all work lists.
+  }
   int initialized = new_max_var - old_max_var;
   stats.vars += initialized;
   stats.unused += initialized;
@@ -195,6 +201,7 @@ int Internal::cdcl_loop_with_inprocessing () {
 
   if (stable) { START (stable);   report ('['); }
   else        { START (unstable); report ('{'); }
+  BEGIN_EVENT (stable ? "stable" : "unstable");
 
   while (!res) {
          if (unsat) res = 20;
@@ -215,6 +222,7 @@ int Internal::cdcl_loop_with_inprocessing () {
     else res = decide ();                    // next decision
   }
 
+  END_EVENT (stable ? "stable" : "unstable");
   if (stable) { STOP (stable);   report (']'); }
   else        { STOP (unstable); report ('}'); }
 
@@ -456,6 +464,7 @@ bool Internal::preprocess_round (int round) {
   after.clauses = stats.current.irredundant;
   assert (preprocessing);
   preprocessing = false;
+  release_occs ();
   PHASE ("preprocessing", stats.preprocessings,
     "finished round %d with %" PRId64 " variables and %" PRId64 " clauses",
     round, after.vars, after.clauses);
@@ -684,6 +693,7 @@ int Internal::lookahead () {
 
 void Internal::print_statistics () {
   stats.print (this);
+  if (opts.verbose > 0) histograms.print (this);
   if (checker) checker->print_stats ();
 }
 
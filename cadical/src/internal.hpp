@@ -26,6 +26,7 @@ extern "C" {
 // Common 'C++' headers.
 
 #include <algorithm>
+#include <atomic>
 #include <queue>
 #include <string>
 #include <vector>
@@ -42,32 +43,43 @@ extern "C" {
 
 #include "arena.hpp"
 #include "averages.hpp"
+#include "batch.hpp"
 #include "bins.hpp"
 #include "block.hpp"
 #include "cadical.hpp"
 #include "checker.hpp"
 #include "clause.hpp"
 #include "config.hpp"
+#include "conquer.hpp"
 #include "contract.hpp"
 #include "cover.hpp"
 #include "elim.hpp"
 #include "ema.hpp"
+#include "events.hpp"
 #include "external.hpp"
 #include "file.hpp"
 #include "flags.hpp"
 #include "format.hpp"
+#include "formula.hpp"
 #include "heap.hpp"
+#include "histogram.hpp"
+#include "hotspots.hpp"
 #include "instantiate.hpp"
 #include "internal.hpp"
 #include "level.hpp"
 #include "limit.hpp"
 #include "logging.hpp"
+#include "memory.hpp"
 #include "message.hpp"
 #include "observer.hpp"
 #include "occs.hpp"
 #include "options.hpp"
+#include "parallel.hpp"
 #include "parse.hpp"
+#include "perf.hpp"
 #include "phases.hpp"
+#include "portfolio.hpp"
+#include "processes.hpp"
 #include "profile.hpp"
 #include "proof.hpp"
 #include "queue.hpp"
@@ -77,6 +89,7 @@ extern "C" {
 #include "reluctant.hpp"
 #include "resources.hpp"
 #include "score.hpp"
+#include "snapshot.hpp"
 #include "stats.hpp"
 #include "terminal.hpp"
 #include "tracer.hpp"
@@ -164,8 +177,10 @@ struct Internal {
   vector<Var> vtab;             // variable table [1,max_var]
   vector<int> parents;          // parent literals during probing
   vector<Flags> ftab;           // variable and literal flags
+  Dirty dirty;                  // work lists of marked variables
   vector<int64_t> btab;         // enqueue time stamps for queue
   vector<int64_t> gtab;         // time stamp table to recompute glue
+  OccsArena oarena;             // contiguous storage for occurrences
   vector<Occs> otab;            // table of occurrences for all literals
   vector<int> ptab;             // table for caching probing attempts
   vector<int64_t> ntab;         // number of one-sided occurrences table
@@ -189,6 +204,7 @@ struct Internal {
   vector<Level> control;        // 'level + 1 == control.size ()'
   vector<Clause*> clauses;      // ordered collection of all clauses
   Averages averages;            // glue, size, jump moving averages
+  Histograms histograms;        // glue, size, jump, trail histograms
   Limit lim;                    // limits for various phases
   Last last;                    // statistics at last occurrence
   Inc inc;                      // increments on limits
@@ -199,8 +215,12 @@ struct Internal {
   Stats stats;                  // statistics
 #ifndef QUIET
   Profiles profiles;            // time profiles for various functions
+  Perf perf;                    // hardware counters for profiles
   bool force_phase_messages;    // force 'phase (...)' messages
 #endif
+  Hotspots hotspots;            // sampled propagation work
+  Events events;                // time line of search phases
+  Snapshot snapshot;            // statistics published while solving
   Arena arena;                  // memory arena for moving garbage collector
   Format error_message;         // provide persistent error message
   string prefix;                // verbose messages prefix
@@ -504,6 +524,15 @@ struct Internal {
   void assign_unit (int lit);
   bool propagate ();
 
+  // Sampling propagation work per clause and variable in 'hotspots.cpp'.
+  //
+  void sample_variable (int lit);
+  void sample_clause (Clause *, int steps);
+  void move_hotspot (Clause *);
+  void forget_hotspot (Clause *);
+  bool traverse_hotspots (HotspotIterator &, int limit);
+  void print_hotspots (int limit);
+
   // Undo and restart in 'backtrack.cpp'.
   //
   void unassign (int lit);
@@ -548,6 +577,11 @@ struct Internal {
   int reuse_trail ();
   void restart ();
 
+  // Importing clauses from a connected importer at restarts.
+  //
+  bool import_clause (const vector<int> &);
+  void import_clauses ();
+
   // Functions to set and reset certain 'phases'.
   //
   void clear_phases (vector<signed char> &);  // reset to zero
@@ -582,6 +616,32 @@ struct Internal {
   //
   bool terminated_asynchronously (int factor = 1);
 
+  // Calling the connected progress call-back in 'progress.cpp', which is
+  // polled in 'terminated_asynchronously' too.
+  //
+  const char * phase_name () const;
+  void notify_progress (int factor);
+
+  // Memory accounting and memory limit in 'memory.cpp'.
+  //
+  void account_memory (Memory &) const;
+  bool memory_limit_approached ();
+  void shrink_memory ();
+
+  // Traversing statistics and publishing copies for other threads while
+  // solving in 'snapshot.cpp'.
+  //
+  bool traverse_statistics (StatisticsIterator &);
+  void publish_snapshot ();
+  void start_publishing ();
+  void stop_publishing ();
+  bool traverse_snapshot (StatisticsIterator &);
+
+  // Recording and writing a time line of phases in 'events.cpp'.
+  //
+  void record_event (const char * name, char type);
+  bool write_events (File *);
+
   bool search_limits_hit ();
 
   void terminate () {
@@ -607,7 +667,7 @@ struct Internal {
   //
   int clause_contains_fixed_literal (Clause *);
   void remove_falsified_literals (Clause *);
-  void mark_satisfied_clauses_as_garbage ();
+  void mark_satisfied_clauses_as_garbage (bool elim = false);
   void copy_clause (Clause *);
   void flush_watches (int lit, Watches &);
   size_t flush_occs (int lit);
@@ -626,6 +686,7 @@ struct Internal {
   void init_bins ();
   void init_noccs ();
   void reset_occs ();
+  void release_occs ();
   void reset_bins ();
   void reset_noccs ();
 
@@ -645,6 +706,7 @@ struct Internal {
   int subsume_check (Clause * subsuming, Clause * subsumed);
   int try_to_subsume_clause (Clause *, vector<Clause*> & shrunken);
   void reset_subsume_bits ();
+  void sort_dirty (vector<int> &);
   bool subsume_round ();
   void subsume (bool update_limits = true);
 
@@ -681,6 +743,8 @@ struct Internal {
 
   // Transitive reduction of binary implication graph in 'transred.cpp'
   //
+  bool transred_bits (int64_t limit, int64_t & propagations,
+                      int64_t & units, int64_t & removed);
   void transred ();
 
   // We monitor the maximum size and glue of clauses during 'reduce' and
@@ -711,6 +775,7 @@ struct Internal {
     if (f.subsume) return;
     LOG ("marking %d as subsuming literal candidate", abs (lit));
     stats.mark.subsume++;
+    dirty.subsume.push_back (abs (lit));
     f.subsume = true;
   }
   void mark_ternary (int lit) {
@@ -718,6 +783,7 @@ struct Internal {
     if (f.ternary) return;
     LOG ("marking %d as ternary resolution literal candidate", abs (lit));
     stats.mark.ternary++;
+    dirty.ternary.push_back (abs (lit));
     f.ternary = true;
   }
   void mark_added (int lit, int size, bool redundant);
@@ -737,6 +803,7 @@ struct Internal {
     if (f.elim) return;
     LOG ("marking %d as elimination literal candidate", lit);
     stats.mark.elim++;
+    dirty.elim.push_back (abs (lit));
     f.elim = true;
   }
   void mark_block (int lit) {
@@ -745,6 +812,7 @@ struct Internal {
     if (f.block & bit) return;
     LOG ("marking %d as blocking literal candidate", lit);
     stats.mark.block++;
+    if (!f.block) dirty.block.push_back (abs (lit));
     f.block |= bit;
   }
   void mark_removed (int lit) {
@@ -890,6 +958,8 @@ struct Internal {
   // Detect strongly connected components in the binary implication graph
   // (BIG) and equivalent literal substitution (ELS) in 'decompose.cpp'.
   //
+  void decompose_sequentially (int * reprs, int & sccs, int & substituted);
+  bool decompose_in_parallel (int * reprs, int & sccs, int & substituted);
   bool decompose_round ();
   void decompose ();
 
@@ -1001,10 +1071,15 @@ struct Internal {
   int lookahead();
   CubesWithStatus generate_cubes(int);
   int most_occurring_literal();
-  int lookahead_probing();
+  int lookahead_probing (const vector<int> * cached = 0,
+                         vector<pair<int,int>> * scored = 0);
   int lookahead_next_probe();
+  int lookahead_next_candidate (const vector<int> * cached, size_t & pos);
   void lookahead_flush_probes();
   void lookahead_generate_probes();
+  void lookahead_score_in_parallel (const vector<int> &, vector<int> &);
+  int lookahead_probe_in_parallel (int res, const vector<int> * cached,
+                                   vector<pair<int,int>> * scored);
   bool terminating_asked();
 
 #ifndef QUIET
@@ -1014,7 +1089,9 @@ struct Internal {
   void stop_profiling (Profile & p, double);
 
   double update_profiles ();    // Returns 'time ()'.
+  bool profiling_hardware ();
   void print_profile ();
+  bool traverse_profiles (StatisticsIterator &);
 #endif
 
   // Get the value of an internal literal: -1=false, 0=unassigned, 1=true.
@@ -1240,6 +1317,19 @@ inline bool Internal::terminated_asynchronously (int factor)
   // the 'termination_forced' flag directly.  The second way is through a
   // call back to a 'terminator' if it is non-zero, which however is costly.
   //
+  // Progress call-backs are polled at the same places as terminators and
+  // with the same check interval, but are only called if enough wall
+  // clock time passed since the last call.
+  //
+  if (external->progress && !lim.progress.check--)
+    notify_progress (factor);
+
+  // Statistics requested by another thread are published here too, since
+  // no counter is updated while checking for termination.
+  //
+  if (snapshot.requested.load (memory_order_relaxed))
+    publish_snapshot ();
+
   if (termination_forced)
   {
     LOG ("termination asynchronously forced");
@@ -16,6 +16,7 @@ struct Limit {
   int64_t condition;       // conflict limit for next 'condition'
   int64_t elim;            // conflict limit for next 'elim'
   int64_t flush;           // conflict limit for next 'flush'
+  int64_t memory;          // conflict limit for next memory check
   int64_t probe;           // conflict limit for next 'probe'
   int64_t reduce;          // conflict limit for next 'reduce'
   int64_t rephase;         // conflict limit for next 'rephase'
@@ -40,6 +41,11 @@ struct Limit {
     int forced;            // forced termination for testing
   } terminate;
 
+  struct {
+    int check;             // countdown to next progress time check
+    double time;           // real time of next progress call-back
+  } progress;
+
   Limit ();
 };
 
@@ -191,6 +191,21 @@ int Internal::lookahead_next_probe () {
   }
 }
 
+// If the candidates are restricted to the 'cached' candidates ranked by
+// the lookahead of the parent cube in 'generate_cubes', then they are
+// taken in that order (best first) instead of from 'probes'.
+
+int Internal::lookahead_next_candidate (const vector<int> * cached,
+                                        size_t & pos) {
+  if (!cached) return lookahead_next_probe ();
+  while (pos < cached->size ()) {
+    const int probe = (*cached)[pos++];
+    if (!active (probe) || assumed (probe) || assumed (-probe)) continue;
+    return probe;
+  }
+  return 0;
+}
+
 bool non_tautological_cube (std::vector<int> cube) {
   std::sort(begin(cube), end(cube), clause_lit_less_than ());
 
@@ -229,7 +244,8 @@ bool Internal::terminating_asked() {
 // The run can be expensive, so we actually first run the cheaper
 // occurrence version and only then run lookahead.
 //
-int Internal::lookahead_probing() {
+int Internal::lookahead_probing (const vector<int> * cached,
+                                 vector<pair<int,int>> * scored) {
 
   if (!active ())
     return 0;
@@ -286,9 +302,12 @@ int Internal::lookahead_probing() {
   set_mode (PROBE);
 
   LOG("unsat = %d, terminating_asked () = %d ", unsat, terminating_asked ());
-  while (!unsat &&
-         !terminating_asked () &&
-         (probe = lookahead_next_probe ())) {
+  size_t pos = 0;
+  if (opts.lookaheadthreads > 1)
+    res = lookahead_probe_in_parallel (res, cached, scored);
+  else while (!unsat &&
+              !terminating_asked () &&
+              (probe = lookahead_next_candidate (cached, pos))) {
     //    if (assumed(probe) || assumed(-probe))
     //  continue;
     stats.probed++;
@@ -298,6 +317,7 @@ int Internal::lookahead_probing() {
     if (probe_propagate ())
       hbrs = trail.size(), backtrack();
     else hbrs = 0, failed_literal (probe);
+    if (scored) scored->push_back ({probe, hbrs});
     if (max_hbrs < hbrs ||
         (max_hbrs == hbrs &&
 	 internal->bumped(probe) > internal->bumped(res))) {
@@ -341,6 +361,207 @@ int Internal::lookahead_probing() {
   return res;
 }
 
+/*------------------------------------------------------------------------*/
+
+// With 'lookaheadthreads' larger than one the candidates are not probed
+// one after the other.  Instead all candidates are scored in parallel on
+// a read-only snapshot of the clauses, in which binary clauses are stored
+// as implication lists and larger clauses with full occurrence lists (both
+// in compressed sparse row format), and root level satisfied clauses and
+// falsified literals are removed.  Each thread has its own private copy
+// of the root level assignment and its own trail and propagates binary
+// clauses first as 'probe_propagate' does.  The score of a candidate is
+// the trail size after propagating it, as in the sequential version, and
+// zero if propagation runs into a conflict.  Since the score only depends
+// on the snapshot, it does not depend on the number of threads nor on
+// their scheduling.
+
+void Internal::lookahead_score_in_parallel (const vector<int> & candidates,
+                                            vector<int> & scores) {
+
+  const int threads = opts.lookaheadthreads;
+  assert (threads > 1);
+  assert (!level);
+
+  const size_t size_lits = 2*(1 + (size_t) max_var);
+
+  vector<size_t> bin_offsets (size_lits + 1, 0);
+  vector<size_t> occ_offsets (size_lits + 1, 0);
+  vector<size_t> lits_offsets (1, 0);
+  vector<unsigned> lits;
+
+  // First pass copies the remaining literals of large clauses and counts
+  // binary implications and occurrences.
+
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    const size_t before = lits.size ();
+    bool satisfied = false;
+    for (const auto & lit : *c) {
+      const signed char tmp = val (lit);
+      if (tmp > 0) { satisfied = true; break; }
+      if (!tmp) lits.push_back (vlit (lit));
+    }
+    const size_t size = lits.size () - before;
+    if (satisfied || size < 2) { lits.resize (before); continue; }
+    if (size == 2) {
+      bin_offsets[(lits[before] ^ 1) + 1]++;
+      bin_offsets[(lits[before + 1] ^ 1) + 1]++;
+      lits.resize (before);
+    } else {
+      for (size_t i = before; i < lits.size (); i++)
+        occ_offsets[lits[i] + 1]++;
+      lits_offsets.push_back (lits.size ());
+    }
+  }
+
+  for (size_t u = 0; u < size_lits; u++)
+    bin_offsets[u + 1] += bin_offsets[u],
+    occ_offsets[u + 1] += occ_offsets[u];
+
+  // Second pass fills the implication and occurrence lists.  Binary
+  // clauses are found again by the same criteria as above.
+
+  vector<unsigned> implied (bin_offsets[size_lits]);
+  vector<unsigned> occs (occ_offsets[size_lits]);
+  {
+    vector<size_t> bin_pos (bin_offsets.begin (), bin_offsets.end () - 1);
+    vector<size_t> occ_pos (occ_offsets.begin (), occ_offsets.end () - 1);
+    for (const auto & c : clauses) {
+      int a, b;
+      if (!is_binary_clause (c, a, b)) continue;
+      const unsigned u = vlit (a), v = vlit (b);
+      implied[bin_pos[u ^ 1]++] = v;
+      implied[bin_pos[v ^ 1]++] = u;
+    }
+    const size_t large = lits_offsets.size () - 1;
+    for (size_t c = 0; c < large; c++)
+      for (size_t i = lits_offsets[c]; i < lits_offsets[c + 1]; i++)
+        occs[occ_pos[lits[i]]++] = c;
+  }
+
+  vector<signed char> root (size_lits, 0);
+  for (auto idx : vars)
+    root[vlit (idx)] = val (idx), root[vlit (-idx)] = val (-idx);
+
+  const int trailed = trail.size ();
+  scores.resize (candidates.size ());
+  atomic<size_t> next (0);
+
+  parallel_run (threads, [&] (int) {
+    vector<signed char> values (root);
+    vector<unsigned> stack;
+    auto assign = [&] (unsigned u) {
+      values[u] = 1, values[u ^ 1] = -1;
+      stack.push_back (u);
+    };
+    for (;;) {
+      const size_t i = next++;
+      if (i >= candidates.size ()) break;
+      stack.clear ();
+      assign (vlit (candidates[i]));
+      bool conflict = false;
+      size_t binary = 0, large = 0;
+      while (!conflict && large < stack.size ()) {
+        if (binary < stack.size ()) {
+          const unsigned u = stack[binary++];
+          for (size_t j = bin_offsets[u]; j < bin_offsets[u + 1]; j++) {
+            const unsigned v = implied[j];
+            const signed char tmp = values[v];
+            if (tmp > 0) continue;
+            if (tmp < 0) { conflict = true; break; }
+            assign (v);
+          }
+        } else {
+          const unsigned u = stack[large++] ^ 1;
+          for (size_t j = occ_offsets[u]; j < occ_offsets[u + 1]; j++) {
+            const size_t c = occs[j];
+            unsigned unit = 0;
+            unsigned unassigned = 0;
+            bool satisfied = false;
+            for (size_t k = lits_offsets[c]; k < lits_offsets[c + 1]; k++) {
+              const signed char tmp = values[lits[k]];
+              if (tmp > 0) { satisfied = true; break; }
+              if (!tmp && !unassigned++) unit = lits[k];
+            }
+            if (satisfied || unassigned > 1) continue;
+            if (!unassigned) { conflict = true; break; }
+            assign (unit);
+          }
+        }
+      }
+      scores[i] = conflict ? 0 : trailed + (int) stack.size ();
+      for (const auto & u : stack)
+        values[u] = values[u ^ 1] = 0;
+    }
+  });
+}
+
+// All candidates of a round are scored in parallel and thus with respect
+// to the same root level assignment.  Candidates with a conflict are then
+// probed sequentially in candidate order to learn the failed literals
+// with 'failed_literal'.  If this produced new units, then all candidates
+// are scored again in the next round, similar to the sequential version,
+// which regenerates probes after new units.  Finally the split literal is
+// selected in candidate order with the same comparison (score and then
+// 'bumped') as in the sequential version.  In contrast to the sequential
+// version no hyper binary resolvents are added while scoring.
+
+int Internal::lookahead_probe_in_parallel (int res,
+                                           const vector<int> * cached,
+                                           vector<pair<int,int>> * scored) {
+
+  vector<int> candidates, scores;
+  int max_hbrs = -1;
+
+  while (!unsat && !terminating_asked ()) {
+
+    candidates.clear ();
+    size_t pos = 0;
+    int probe;
+    while ((probe = lookahead_next_candidate (cached, pos))) {
+      propfixed (probe) = stats.all.fixed;
+      candidates.push_back (probe);
+    }
+    if (candidates.empty ()) break;
+
+    lookahead_score_in_parallel (candidates, scores);
+    stats.probed += candidates.size ();
+
+    const int64_t fixed = stats.all.fixed;
+    for (size_t i = 0; !unsat && i < candidates.size (); i++) {
+      if (scores[i]) continue;
+      const int lit = candidates[i];
+      if (!active (lit)) continue;
+      probe_assign_decision (lit);
+      if (probe_propagate ()) backtrack ();
+      else failed_literal (lit);
+    }
+    if (unsat) break;
+    if (stats.all.fixed > fixed) continue;
+
+    for (size_t i = 0; i < candidates.size (); i++) {
+      const int lit = candidates[i];
+      const int hbrs = scores[i];
+      if (scored) scored->push_back ({lit, hbrs});
+      if (max_hbrs < hbrs ||
+          (max_hbrs == hbrs && bumped (lit) > bumped (res))) {
+        res = lit;
+        max_hbrs = hbrs;
+      }
+    }
+
+    PHASE ("lookahead-probe-round", stats.probingrounds,
+      "scored %zd candidates using %d threads",
+      candidates.size (), opts.lookaheadthreads);
+    break;
+  }
+
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 CubesWithStatus Internal::generate_cubes(int depth) {
 
   if (!active ())
@@ -368,14 +589,32 @@ CubesWithStatus Internal::generate_cubes(int depth) {
   reset_limits();
   LOG ("generate cubes with %zu assumptions\n", assumptions.size());
 
+  START (lookahead);
+  assert (!lookingahead);
+  lookingahead = true;
+
   std::vector<int> current_assumptions{assumptions};
   std::vector<std::vector<int>> cubes {{assumptions}};
 
+  // With 'lookaheadtop' non-zero the candidates probed in a cube are
+  // ranked by their score and this ranking is kept for both child cubes,
+  // which then only probe the 'lookaheadtop' best ranked candidates of
+  // their parent which are still active.  If less than half of them are
+  // left all candidates are probed again.
+
+  const size_t top = opts.lookaheadtop;
+  std::vector<std::vector<int>> rankings {{}}, rankings2;
+  std::vector<std::pair<int,int>> scored;
+  std::vector<int> cached;
+  int64_t probed = 0;
+
   for (int i = 0; i < depth; ++i) {
     LOG("Probing at depth %i, currently %zu have been generated",
         i, cubes.size());
     std::vector<std::vector<int>> cubes2 {std::move(cubes)};
     cubes.clear ();
+    rankings2 = std::move (rankings);
+    rankings.clear ();
 
     for (size_t j = 0; j < cubes2.size(); ++j) {
 
@@ -389,12 +628,43 @@ CubesWithStatus Internal::generate_cubes(int depth) {
         continue;
       }
 
-      int res = lookahead_probing();
+      cached.clear ();
+      for (const auto & lit : rankings2[j]) {
+        if (cached.size () == top) break;
+        if (active (lit) && !assumed (lit) && !assumed (-lit))
+          cached.push_back (lit);
+      }
+      const bool use_cached = top && 2*cached.size () >= top;
+      if (use_cached)
+        LOG ("probing %zu cached candidates of parent cube", cached.size ());
+
+      scored.clear ();
+      const int64_t before = stats.probed;
+      int res = lookahead_probing (use_cached ? &cached : 0,
+                                  top ? &scored : 0);
+      probed += stats.probed - before;
       if(res == INT_MIN){
         LOG ("found unsat cube");
         continue;
       }
 
+      if (!res) {
+        LOG ("no splitting literal left");
+        cubes.push_back (std::move (cubes2[j]));
+        rankings.push_back (std::move (rankings2[j]));
+        continue;
+      }
+
+      std::vector<int> ranking;
+      if (top) {
+        std::stable_sort (scored.begin (), scored.end (),
+          [] (const std::pair<int,int> & a, const std::pair<int,int> & b) {
+            return a.second > b.second;
+          });
+        for (const auto & p : scored)
+          ranking.push_back (p.first);
+      }
+
       LOG("splitting on lit %i", res);
       std::vector<int> cube1{cubes2[j]};
       cube1.push_back(res);
@@ -402,12 +672,22 @@ CubesWithStatus Internal::generate_cubes(int depth) {
       cube2.push_back(-res);
       cubes.push_back(cube1);
       cubes.push_back(cube2);
+      rankings.push_back (ranking);
+      rankings.push_back (std::move (ranking));
     }
 
     if(terminating_asked())
       break;
   }
 
+  assert (lookingahead);
+  lookingahead = false;
+  STOP (lookahead);
+
+  VERBOSE (2, "generated %zu cubes with %" PRId64 " lookahead probes "
+    "(%.1f per cube)", cubes.size (), probed,
+    relative (probed, cubes.size ()));
+
   assert(std::for_each(begin(cubes), end(cubes), [](std::vector<int> cube){return non_tautological_cube (cube);}));
   reset_assumptions();
 
@@ -0,0 +1,150 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+Memory::Memory () {
+#define MEMORY_ENTRY(NAME,DESCRIPTION) \
+  NAME = 0;
+  MEMORY
+#undef MEMORY_ENTRY
+}
+
+size_t Memory::total () const {
+  size_t res = 0;
+#define MEMORY_ENTRY(NAME,DESCRIPTION) \
+  res += NAME;
+  MEMORY
+#undef MEMORY_ENTRY
+  return res;
+}
+
+bool Memory::traverse (StatisticsIterator & it) const {
+#define MEMORY_ENTRY(NAME,DESCRIPTION) \
+  if (!it.counter (#NAME, NAME)) return false;
+  MEMORY
+#undef MEMORY_ENTRY
+  return it.counter ("total", total ());
+}
+
+void Memory::print (Internal * internal) const {
+#ifndef QUIET
+  const size_t all = total ();
+#define MEMORY_ENTRY(NAME,DESCRIPTION) \
+  if (NAME) \
+    MSG ("  %-10s %15zd bytes %10.2f %%  %s", \
+      #NAME ":", NAME, percent (NAME, all), DESCRIPTION);
+  MEMORY
+#undef MEMORY_ENTRY
+#else
+  (void) internal;
+#endif
+}
+
+/*------------------------------------------------------------------------*/
+
+template<class T, class A>
+static size_t bytes_vector (const vector<T, A> & v) {
+  return v.capacity () * sizeof (T);
+}
+
+static size_t bytes_vector (const vector<bool> & v) {
+  return v.capacity () / 8;
+}
+
+// The diagnostic 'hotspots' and 'events' buffers are not accounted.
+
+void Internal::account_memory (Memory & m) const {
+
+  m.arena = arena.bytes ();
+
+  m.clauses = bytes_vector (clauses);
+  for (const auto & c : clauses)
+    if (!arena.contains (c)) m.clauses += c->bytes ();
+
+  m.watches = bytes_vector (wtab);
+  for (const auto & ws : wtab) m.watches += bytes_vector (ws);
+
+  m.occs = bytes_vector (otab) + oarena.size () * sizeof (Clause *);
+  for (const auto & os : otab)
+    if (!oarena.contains (os.data ())) m.occs += bytes_vector (os);
+
+  m.bins = bytes_vector (big);
+  for (const auto & bs : big) m.bins += bytes_vector (bs);
+
+  m.vars = 2 * vsize * sizeof (signed char);
+  m.vars += bytes_vector (marks) + bytes_vector (frozentab);
+  m.vars += bytes_vector (i2e) + bytes_vector (links);
+  m.vars += bytes_vector (stab) + bytes_vector (vtab);
+  m.vars += bytes_vector (parents) + bytes_vector (ftab);
+  m.vars += bytes_vector (btab) + bytes_vector (gtab);
+  m.vars += bytes_vector (ptab) + bytes_vector (ntab);
+  m.vars += bytes_vector (phases.best) + bytes_vector (phases.forced);
+  m.vars += bytes_vector (phases.min) + bytes_vector (phases.prev);
+  m.vars += bytes_vector (phases.saved) + bytes_vector (phases.target);
+  m.vars += scores.bytes ();
+
+  m.stacks = bytes_vector (trail) + bytes_vector (clause);
+  m.stacks += bytes_vector (assumptions) + bytes_vector (original);
+  m.stacks += bytes_vector (levels) + bytes_vector (analyzed);
+  m.stacks += bytes_vector (minimized) + bytes_vector (probes);
+  m.stacks += bytes_vector (control);
+  m.stacks += bytes_vector (dirty.elim) + bytes_vector (dirty.subsume);
+  m.stacks += bytes_vector (dirty.ternary) + bytes_vector (dirty.block);
+
+  m.extension = bytes_vector (external->extension);
+  m.extension += bytes_vector (external->witness);
+
+  m.original = bytes_vector (external->original);
+
+  m.external = bytes_vector (external->vals) + bytes_vector (external->e2i);
+  m.external += bytes_vector (external->assumptions);
+  m.external += bytes_vector (external->tainted);
+  m.external += bytes_vector (external->frozentab);
+  m.external += bytes_vector (external->moltentab);
+
+  m.checker = checker ? checker->bytes () : 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+// With a memory limit ('--memlimit=<MB>') the accounted memory is checked
+// regularly.  If it reaches 90% of the limit, then 'reducing' triggers a
+// reduction right away, which in this case flushes all redundant clauses
+// not used recently (see 'reduce').  This is a soft limit, i.e., if
+// irredundant clauses alone need too much memory, solving continues, while
+// still reducing at every check.
+//
+// Accounting goes over all clauses and literals.  In order to amortize
+// this cost the check interval of 'memlimitint' conflicts is scaled by the
+// number of clauses and literals per 10'000.  Since each conflict adds at
+// most one clause, the number of clauses then grows by at most 10% between
+// two checks (with the default interval), which fits the 10% margin.
+
+bool Internal::memory_limit_approached () {
+  if (!opts.memlimit) return false;
+  if (stats.conflicts < lim.memory) return false;
+  int64_t delta = opts.memlimitint;
+  const double scale = (clauses.size () + wtab.size ()) / 1e4;
+  if (scale > 1) delta *= scale;
+  lim.memory = stats.conflicts + delta;
+  Memory memory;
+  account_memory (memory);
+  const double limit = opts.memlimit * (double) (1u << 20);
+  const size_t bytes = memory.total ();
+  if (bytes < 0.9 * limit) return false;
+  VERBOSE (2, "accounted memory %.0f MB reaching %.0f%% of limit %d MB",
+    bytes / (double) (1u << 20), percent (bytes, limit), opts.memlimit);
+  return true;
+}
+
+// Under memory pressure we also give back the slack of watch lists and
+// the clause table after garbage collection.
+
+void Internal::shrink_memory () {
+  for (auto & ws : wtab) shrink_vector (ws);
+  shrink_vector (clauses);
+}
+
+}
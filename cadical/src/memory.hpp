@@ -0,0 +1,50 @@
+#ifndef _memory_hpp_INCLUDED
+#define _memory_hpp_INCLUDED
+
+#include <cstddef>
+
+namespace CaDiCaL {
+
+class StatisticsIterator;
+struct Internal;
+
+// Byte level accounting of the major data structures, complementing the
+// maximum resident set size, which only gives one number for the whole
+// process.  Containers are accounted by their capacity, not their size,
+// and nested containers, e.g., watch lists, by the sum of the capacity of
+// all their elements.  Allocation overhead of the C++ library is ignored.
+//
+// Computing the accounting goes over all literals and clauses, thus it is
+// only done on demand, e.g., when checking the memory limit ('memlimit').
+
+#define MEMORY \
+MEMORY_ENTRY(arena, "arena of moved clauses") \
+MEMORY_ENTRY(clauses, "clauses outside of the arena") \
+MEMORY_ENTRY(watches, "watch lists") \
+MEMORY_ENTRY(occs, "occurrence lists") \
+MEMORY_ENTRY(bins, "binary implication graph") \
+MEMORY_ENTRY(vars, "variable and literal tables") \
+MEMORY_ENTRY(stacks, "trail and other work stacks") \
+MEMORY_ENTRY(extension, "extension stack") \
+MEMORY_ENTRY(original, "original clauses for checking") \
+MEMORY_ENTRY(external, "external variable tables") \
+MEMORY_ENTRY(checker, "online proof checker")
+
+struct Memory {
+
+#define MEMORY_ENTRY(NAME,DESCRIPTION) \
+  size_t NAME;
+  MEMORY
+#undef MEMORY_ENTRY
+
+  Memory ();
+
+  size_t total () const;
+
+  bool traverse (StatisticsIterator &) const;
+  void print (Internal *) const;
+};
+
+}
+
+#endif
@@ -972,6 +972,7 @@ bool Trace::ignored_option (const char * name) {
 
   if (!strcmp (name, "checkfrozen")) return true;
   if (!strcmp (name, "terminateint")) return true;
+  if (!strcmp (name, "profilehw")) return true;
 
   return false;
 }
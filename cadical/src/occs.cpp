@@ -6,18 +6,55 @@ namespace CaDiCaL {
 
 // Occurrence lists.
 
+// The occurrence lists are allocated from one contiguous table in two
+// passes.  First the occurrences of literals in irredundant clauses are
+// counted and then each literal gets a slice of the table of this size
+// plus some slack in literal order.  Simplifiers connecting other clauses
+// (or adding many clauses) just end up using the space left at the end of
+// the table or the heap.  During preprocessing the table is kept until the
+// end of the round and thus shared by all simplifiers of that round.
+
 void Internal::init_occs () {
+  if (otab.empty ()) {
+    const size_t size = 2*vsize;
+    vector<unsigned> count (size, 0);
+    for (const auto & c : clauses) {
+      if (c->garbage || c->redundant) continue;
+      for (const auto & lit : *c)
+        count[vlit (lit)]++;
+    }
+    size_t total = 0;
+    for (auto & n : count)
+      total += (n += 1 + n/4);
+    oarena.reset (total + total/8);
+    LOG ("reserved %zd occurrences in table of size %zd",
+      total, oarena.size ());
+    otab.reserve (size);
+    const OccsAllocator<Clause*> allocator (&oarena);
+    for (const auto & n : count) {
+      otab.push_back (Occs (allocator));
+      otab.back ().reserve (n);
+    }
+  }
   while (otab.size () < 2*vsize)
-    otab.push_back (Occs ());
+    otab.push_back (Occs (OccsAllocator<Clause*> (&oarena)));
   LOG ("initialized occurrence lists");
 }
 
 void Internal::reset_occs () {
   assert (occurring ());
   erase_vector (otab);
+  if (!preprocessing) release_occs ();
   LOG ("reset occurrence lists");
 }
 
+void Internal::release_occs () {
+  assert (!occurring ());
+  if (!oarena.size ()) return;
+  oarena.release ();
+  LOG ("released occurrence table");
+}
+
 /*------------------------------------------------------------------------*/
 
 // One-sided occurrence counter (each literal has its own counter).
@@ -1,6 +1,9 @@
 #ifndef _occs_h_INCLUDED
 #define _occs_h_INCLUDED
 
+#include <cstddef>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 namespace CaDiCaL {
@@ -11,10 +14,94 @@ namespace CaDiCaL {
 struct Clause;
 using namespace std;
 
-typedef vector<Clause*> Occs;
+// Instead of allocating each occurrence list on its own, 'init_occs'
+// counts the occurrences of all literals first and then reserves for each
+// literal a slice of one contiguous table in literal order (with some
+// slack for clauses added later).  This gives a compressed sparse row
+// layout of the occurrence lists without changing their interface.  Lists
+// outgrowing their slice are moved to the remaining space at the end of
+// the table or to the heap if the table is full.  Releasing memory in the
+// table is a no-op, and the table is only reset as a whole if all lists
+// are gone, thus can be kept and reused by consecutive simplifiers.
 
-inline void shrink_occs (Occs & os) { shrink_vector (os); }
-inline void erase_occs (Occs & os) { erase_vector (os); }
+class OccsArena {
+  vector<Clause*> table;
+  size_t top;
+public:
+  OccsArena () : top (0) { }
+  Clause ** allocate (size_t n) {
+    if (table.size () - top < n) return 0;
+    Clause ** res = table.data () + top;
+    top += n;
+    return res;
+  }
+  bool contains (Clause * const * p) const {
+    return table.data () <= p && p < table.data () + table.size ();
+  }
+  void reset (size_t size) {
+    top = 0;
+    if (table.size () >= size) return;
+    vector<Clause*> ().swap (table);
+    table.resize (size);
+  }
+  void release () {
+    top = 0;
+    vector<Clause*> ().swap (table);
+  }
+  size_t size () const { return table.size (); }
+};
+
+template<class T> struct OccsAllocator {
+
+  typedef T value_type;
+  typedef true_type propagate_on_container_copy_assignment;
+  typedef true_type propagate_on_container_move_assignment;
+  typedef true_type propagate_on_container_swap;
+
+  OccsArena * arena;
+
+  OccsAllocator (OccsArena * a = 0) : arena (a) { }
+  template<class U>
+  OccsAllocator (const OccsAllocator<U> & other) : arena (other.arena) { }
+
+  T * allocate (size_t n) {
+    T * res = 0;
+    if (arena && is_same<T, Clause*>::value)
+      res = (T *) arena->allocate (n);
+    if (!res) res = static_cast<T*> (::operator new (n * sizeof (T)));
+    return res;
+  }
+
+  void deallocate (T * p, size_t) {
+    if (arena && arena->contains ((Clause * const *) p)) return;
+    ::operator delete (p);
+  }
+};
+
+template<class T, class U>
+bool operator == (const OccsAllocator<T> & a, const OccsAllocator<U> & b) {
+  return a.arena == b.arena;
+}
+
+template<class T, class U>
+bool operator != (const OccsAllocator<T> & a, const OccsAllocator<U> & b) {
+  return a.arena != b.arena;
+}
+
+typedef vector<Clause*, OccsAllocator<Clause*> > Occs;
+
+// Shrinking lists in the table would only waste space there.
+
+inline void shrink_occs (Occs & os) {
+  if (os.capacity () == os.size ()) return;
+  const OccsArena * arena = os.get_allocator ().arena;
+  if (arena && arena->contains (os.data ())) return;
+  Occs (os).swap (os);
+}
+
+inline void erase_occs (Occs & os) {
+  if (os.capacity ()) Occs (os.get_allocator ()).swap (os);
+}
 
 inline void remove_occs (Occs & os, Clause * c) {
   const auto end = os.end ();
@@ -0,0 +1,54 @@
+#ifndef _parallel_hpp_INCLUDED
+#define _parallel_hpp_INCLUDED
+
+#include <cassert>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+// Minimal fork-join support for those few algorithms which can split their
+// work into independent parts working on shared but otherwise read-only
+// data (or on disjoint parts of shared tables).  The calling thread always
+// works on part zero itself, thus with just one thread no additional thread
+// is started at all.  Since the solver state is not thread safe, workers
+// must not call any function which changes 'Internal' (including logging).
+
+template<class F> void parallel_run (int threads, F work) {
+  assert (threads > 0);
+  vector<thread> workers;
+  workers.reserve (threads - 1);
+  for (int i = 1; i < threads; i++)
+    workers.emplace_back (work, i);
+  work (0);
+  for (auto & worker : workers)
+    worker.join ();
+}
+
+// Number of hardware threads, which is used as default number of threads
+// by the parallel solvers (at least one).
+
+inline int hardware_threads () {
+  const int res = thread::hardware_concurrency ();
+  return res > 0 ? res : 1;
+}
+
+// Split the index range '[0,size)' into 'threads' consecutive chunks of
+// almost the same size and call 'work (begin, end, i)' for chunk 'i'.
+
+template<class F> void parallel_for (int threads, size_t size, F work) {
+  assert (threads > 0);
+  parallel_run (threads, [&] (int i) {
+    const size_t chunk = size / threads, rest = size % threads;
+    const size_t begin = chunk * i + min (rest, (size_t) i);
+    const size_t end = begin + chunk + ((size_t) i < rest);
+    work (begin, end, i);
+  });
+}
+
+}
+
+#endif
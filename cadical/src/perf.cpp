@@ -0,0 +1,94 @@
+#ifndef QUIET
+
+#include "internal.hpp"
+
+/*------------------------------------------------------------------------*/
+
+#ifdef __linux__
+extern "C" {
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+}
+#endif
+
+namespace CaDiCaL {
+
+Perf::Perf () : tried (false), opened (false) {
+  for (int i = 0; i < EVENTS; i++)
+    fds[i] = -1;
+}
+
+Perf::~Perf () { close (); }
+
+#ifdef __linux__
+
+// All counters are put into one group with the first as leader, such that
+// they are scheduled together and can be read with one system call.
+
+static int open_event (uint64_t config, int leader) {
+  struct perf_event_attr attr;
+  memset (&attr, 0, sizeof attr);
+  attr.size = sizeof attr;
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = leader < 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+  return syscall (__NR_perf_event_open, &attr, 0, -1, leader, 0);
+}
+
+bool Perf::open () {
+  if (tried) return opened;
+  tried = true;
+  static const uint64_t configs[EVENTS] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+  };
+  for (int i = 0; i < EVENTS; i++) {
+    fds[i] = open_event (configs[i], i ? fds[0] : -1);
+    if (fds[i] < 0) { close (); return false; }
+  }
+  ioctl (fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl (fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  opened = true;
+  return true;
+}
+
+void Perf::close () {
+  for (int i = 0; i < EVENTS; i++)
+    if (fds[i] >= 0) ::close (fds[i]), fds[i] = -1;
+  opened = false;
+}
+
+// With 'PERF_FORMAT_GROUP' reading the leader gives the number of events
+// followed by their values.
+
+void Perf::read (uint64_t * values) {
+  assert (opened);
+  uint64_t buffer[1 + EVENTS];
+  const ssize_t bytes = sizeof buffer;
+  if (::read (fds[0], buffer, bytes) != bytes || buffer[0] != EVENTS)
+    memset (buffer, 0, bytes);
+  for (int i = 0; i < EVENTS; i++)
+    values[i] = buffer[1 + i];
+}
+
+#else
+
+bool Perf::open () { tried = true; return false; }
+void Perf::close () { }
+void Perf::read (uint64_t * values) {
+  for (int i = 0; i < EVENTS; i++)
+    values[i] = 0;
+}
+
+#endif
+
+}
+
+#endif // ifndef QUIET
@@ -0,0 +1,51 @@
+#ifndef _perf_hpp_INCLUDED
+#define _perf_hpp_INCLUDED
+
+/*------------------------------------------------------------------------*/
+#ifndef QUIET
+/*------------------------------------------------------------------------*/
+
+#include <cstdint>
+
+namespace CaDiCaL {
+
+// Optional hardware performance counters for the built-in profiling, which
+// are enabled with '--profilehw'.  They rely on 'perf_event_open' and thus
+// are only available on Linux (and might also need a small enough value of
+// '/proc/sys/kernel/perf_event_paranoid').  Only events of the thread
+// which first started a profile are counted and kernel events are
+// excluded.  Profiles then accumulate the differences of these counters
+// between 'START' and 'STOP' in the same way as they accumulate time.
+//
+// Reading the counters is a system call, thus more costly than 'getrusage'
+// and should only be combined with small profiling levels.
+
+struct Perf {
+
+  enum {
+    CYCLES = 0,
+    INSTRUCTIONS = 1,
+    CACHE_MISSES = 2,
+    BRANCH_MISSES = 3,
+    EVENTS = 4,
+  };
+
+  int fds[EVENTS];      // file descriptors of the event group
+  bool tried;           // tried to open counters already
+  bool opened;          // all counters successfully opened
+
+  Perf ();
+  ~Perf ();
+
+  bool open ();                 // returns 'false' if not available
+  void close ();
+  void read (uint64_t * values); // reads 'EVENTS' current counter values
+};
+
+}
+
+/*------------------------------------------------------------------------*/
+#endif // ifndef QUIET
+/*------------------------------------------------------------------------*/
+
+#endif
@@ -0,0 +1,477 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// All solvers of the portfolio have this terminator connected, which is
+// cheap to call and thus does not need a larger 'terminateint'.
+
+struct PortfolioTerminator : public Terminator {
+  Portfolio * portfolio;
+  PortfolioTerminator (Portfolio * p) : portfolio (p) { }
+  bool terminate () { return portfolio->done; }
+};
+
+/*------------------------------------------------------------------------*/
+
+void ClauseRing::push (const vector<int> & clause) {
+  const uint64_t size = clause.size ();
+  assert (size < capacity);
+  const uint64_t start = head.load (memory_order_relaxed);
+  const uint64_t end = start + size + 1;
+  reserved.store (end, memory_order_relaxed);
+  atomic_thread_fence (memory_order_release);
+  uint64_t pos = start;
+  lits[pos++ % capacity].store ((int) size, memory_order_relaxed);
+  for (const auto & lit : clause)
+    lits[pos++ % capacity].store (lit, memory_order_relaxed);
+  head.store (end, memory_order_release);
+}
+
+bool ClauseRing::read (uint64_t & position, vector<int> & clause) {
+  const uint64_t end = head.load (memory_order_acquire);
+  if (position >= end) return false;
+  if (end - position > capacity) { position = end; return false; }
+  uint64_t pos = position;
+  const int size = lits[pos++ % capacity].load (memory_order_relaxed);
+  clause.clear ();
+  if (0 < size && (uint64_t) size < capacity)
+    for (int i = 0; i < size; i++)
+      clause.push_back (lits[pos++ % capacity].load (memory_order_relaxed));
+  atomic_thread_fence (memory_order_acquire);
+  if (reserved.load (memory_order_relaxed) - position > capacity) {
+    position = end;                             // Overwritten while read.
+    return false;
+  }
+  assert (0 < size);
+  position = pos;
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+uint64_t ClauseFilter::hash (const vector<int> & clause) {
+  sorted = clause;
+  sort (sorted.begin (), sorted.end ());
+  uint64_t res = 0;
+  for (const auto & lit : sorted)
+    res = (res + (unsigned) lit) * 0x9e3779b97f4a7c15ull,
+    res ^= res >> 29;
+  return res;
+}
+
+bool ClauseFilter::fresh (const vector<int> & clause) {
+  if (imported.size () > (1u << 20)) imported.clear ();
+  return imported.insert (hash (clause)).second;
+}
+
+bool RingLearner::learning (int clause_size) {
+  return 0 < clause_size && clause_size <= size;
+}
+
+void RingLearner::learn (int lit) {
+  if (lit) clause.push_back (lit);
+  else ring->push (clause), clause.clear ();
+}
+
+bool RingImporter::import (vector<int> & clause) {
+  for (size_t idx = 0; idx < rings.size (); idx++) {
+    if (idx == self) continue;
+    while (rings[idx]->read (positions[idx], clause))
+      if (filter.fresh (clause)) return true;
+  }
+  return false;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Learned clauses with at most 'sharesize' literals are exported to the
+// ring of the learning solver, or in deterministic mode collected until
+// the end of the round.  The glue limit is applied by the solvers through
+// the 'exportglue' option.
+
+struct PortfolioLearner : public Learner {
+  Portfolio * portfolio;
+  const size_t self;
+  vector<int> clause;
+  PortfolioLearner (Portfolio * p, size_t idx) :
+    portfolio (p), self (idx) { }
+  bool learning (int size) {
+    return 0 < size && size <= portfolio->sharesize;
+  }
+  void learn (int lit) {
+    if (portfolio->interval) {
+      portfolio->exported[self].push_back (lit);
+      return;
+    }
+    if (lit) clause.push_back (lit);
+    else portfolio->rings[self]->push (clause), clause.clear ();
+  }
+};
+
+// Clauses of other solvers are imported by going over their rings in a
+// round robin fashion and filtering duplicates.  In deterministic mode the
+// clauses learned by the other solvers in the last round are imported from
+// 'pending' instead, right after the round ended at the first restart
+// after the conflict 'boundary'.  Boundaries are multiples of 'interval',
+// thus do not depend on when the restart happens.
+
+struct PortfolioImporter : public Importer {
+
+  Portfolio * portfolio;
+  const size_t self;
+  vector<uint64_t> positions;
+  size_t next;                  // position in 'pending'
+  int64_t boundary;             // conflicts ending the current round
+  ClauseFilter filter;
+
+  PortfolioImporter (Portfolio * p, size_t idx, size_t size) :
+    portfolio (p), self (idx), positions (size, 0), next (0),
+    boundary (0) { }
+
+  bool import_pending (vector<int> & clause) {
+    const vector<int> & pending = portfolio->pending[self];
+    while (next < pending.size ()) {
+      clause.clear ();
+      int lit;
+      while ((lit = pending[next++])) clause.push_back (lit);
+      if (filter.fresh (clause)) return true;
+    }
+    return false;
+  }
+
+  bool import_synchronized (vector<int> & clause) {
+    if (import_pending (clause)) return true;
+    const int64_t conflicts = portfolio->conflicts (self);
+    if (conflicts < boundary) return false;
+    const int64_t interval = portfolio->interval;
+    boundary = (conflicts / interval + 1) * interval;
+    if (!portfolio->barrier ()) return false;
+    return import_pending (clause);
+  }
+
+  bool import (vector<int> & clause) {
+    if (portfolio->interval) return import_synchronized (clause);
+    const size_t size = positions.size ();
+    for (size_t idx = 0; idx < size; idx++) {
+      if (idx == self) continue;
+      ClauseRing * ring = portfolio->rings[idx];
+      while (ring->read (positions[idx], clause))
+        if (filter.fresh (clause)) return true;
+    }
+    return false;
+  }
+};
+
+/*------------------------------------------------------------------------*/
+
+Portfolio::Portfolio (int size) :
+  sharesize (0), interval (0), exported (size), pending (size),
+  max_var (0), terminator (0),
+  solving (false), done (false), running (0),
+  arrived (0), rounds (0),
+  winner (-1), res (0)
+{
+  assert (size > 0);
+  for (int idx = 0; idx < size; idx++) {
+    Solver * solver = new Solver ();
+    Terminator * connected = new PortfolioTerminator (this);
+    solver->connect_terminator (connected);
+    solvers.push_back (solver);
+    terminators.push_back (connected);
+    rings.push_back (new ClauseRing ());
+    Learner * learner = new PortfolioLearner (this, idx);
+    Importer * importer = new PortfolioImporter (this, idx, size);
+    solver->connect_learner (learner);
+    learners.push_back (learner);
+    importers.push_back (importer);
+    diversify (solver, idx);
+  }
+  share (8, 2);
+}
+
+Portfolio::~Portfolio () {
+  for (auto solver : solvers) delete solver;
+  for (auto terminator : terminators) delete terminator;
+  for (auto learner : learners) delete learner;
+  for (auto importer : importers) delete importer;
+  for (auto ring : rings) delete ring;
+}
+
+// Solver zero keeps the default configuration.  Then we cycle through the
+// pre-defined configurations, starting with 'sat' which only uses stable
+// mode, followed by 'unsat' which never uses it.  Beyond the first four
+// solvers variables are shuffled with different random seeds.
+
+void Portfolio::diversify (Solver * solver, int idx) {
+  switch (idx % 4) {
+    case 1: solver->configure ("sat"); break;
+    case 2: solver->configure ("unsat"); break;
+    case 3: solver->set ("phase", 0); break;
+    default: break;
+  }
+  if (idx < 4) return;
+  solver->set ("seed", idx);
+  solver->set ("shuffle", 1);
+  solver->set ("shufflerandom", 1);
+}
+
+// Sharing is disabled with a zero 'size'.
+
+void Portfolio::share (int size, int glue) {
+  sharesize = size;
+  for (auto solver : solvers)
+    solver->set ("exportglue", glue);
+}
+
+// Imported clauses can not be checked (see 'Solver::connect_importer').
+
+bool Portfolio::checking () {
+  for (auto solver : solvers)
+    if (solver->get ("check") && solver->get ("checkproof"))
+      return true;
+  return false;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Each solver runs in its own thread and first copies the shared clauses
+// and assumptions.  The first solver to finish with a result is the
+// winner and forces all the others to terminate.  In deterministic mode
+// the winner is only determined when the round is completed, either by
+// the last solver arriving at the barrier or the last one finishing.
+
+void Portfolio::work (int idx) {
+  Solver * solver = solvers[idx];
+  for (const auto & lit : clauses)
+    solver->add (lit);
+  int tmp = 0;
+  if (!done) {
+    for (const auto & lit : assumptions)
+      solver->assume (lit);
+    tmp = solver->solve ();     // also resets assumptions
+  }
+  lock_guard<mutex> guard (lock);
+  if (interval) {
+    if (tmp && (winner < 0 || idx < winner))
+      winner = idx, res = tmp;
+  } else if (tmp && winner < 0) {
+    winner = idx;
+    res = tmp;
+    done = true;
+  }
+  running--;
+  if (interval && arrived && arrived == running) complete ();
+  finished.notify_one ();
+}
+
+// Only called by the solver thread itself from its importer.
+
+int64_t Portfolio::conflicts (int idx) {
+  return solvers[idx]->internal->stats.conflicts;
+}
+
+// The clauses learned by each solver in the last round are given to all
+// the other solvers in the order of the solver index.  Thus what a solver
+// sees does neither depend on timing nor on the scheduling of threads.
+// This happens while all running solvers wait in 'barrier'.
+
+void Portfolio::synchronize () {
+  const size_t size = solvers.size ();
+  for (size_t idx = 0; idx < size; idx++) {
+    pending[idx].clear ();
+    for (size_t other = 0; other < size; other++)
+      if (other != idx)
+        pending[idx].insert (pending[idx].end (),
+          exported[other].begin (), exported[other].end ());
+    ((PortfolioImporter*) importers[idx])->next = 0;
+  }
+  for (auto & clauses : exported)
+    clauses.clear ();
+}
+
+// Called with 'lock' held by the last solver which ended the round, either
+// by arriving at the barrier or by finishing.  The latter are the only
+// solvers which can determine the result in this round.
+
+void Portfolio::complete () {
+  assert (interval);
+  assert (arrived == running);
+  arrived = 0;
+  if (winner >= 0) done = true;
+  else synchronize ();
+  rounds++;
+  completed.notify_all ();
+}
+
+// Returns false if the solver has to stop.  The 'done' flag might also be
+// set asynchronously by 'terminate' without holding the lock, thus waiting
+// is bounded.
+
+bool Portfolio::barrier () {
+  unique_lock<mutex> guard (lock);
+  const int64_t round = rounds;
+  if (++arrived == running) complete ();
+  else
+    while (!done && rounds == round)
+      completed.wait_for (guard, chrono::milliseconds (10));
+  return !done;
+}
+
+int Portfolio::solve () {
+
+  winner = -1;
+  res = 0;
+  done = false;
+  solving = true;
+
+  const int size = solvers.size ();
+  running = size;
+  arrived = 0;
+  rounds = 0;
+
+  for (int idx = 0; idx < size; idx++) {
+    if (sharesize || interval)
+      solvers[idx]->connect_importer (importers[idx]);
+    else
+      solvers[idx]->disconnect_importer ();
+  }
+
+  for (int idx = 0; interval && idx < size; idx++) {
+    PortfolioImporter * importer = (PortfolioImporter*) importers[idx];
+    importer->boundary = (conflicts (idx) / interval + 1) * interval;
+  }
+
+  vector<thread> threads;
+  threads.reserve (size);
+  for (int idx = 0; idx < size; idx++)
+    threads.emplace_back (&Portfolio::work, this, idx);
+
+  // The external terminator is only called from this thread and not from
+  // the solver threads, since it might not be thread safe.
+  {
+    unique_lock<mutex> guard (lock);
+    while (running) {
+      finished.wait_for (guard, chrono::milliseconds (10));
+      if (done || !terminator) continue;
+      guard.unlock ();
+      if (terminator->terminate ()) done = true;
+      guard.lock ();
+      if (done) completed.notify_all ();
+    }
+  }
+
+  for (auto & thread : threads)
+    thread.join ();
+
+  // Now all solvers copied the clauses and we can release them.  Clauses
+  // learned in an unfinished round are not imported anymore.
+
+  erase_vector (clauses);
+  assumptions.clear ();
+  for (int idx = 0; idx < size; idx++) {
+    exported[idx].clear (), pending[idx].clear ();
+    ((PortfolioImporter*) importers[idx])->next = 0;
+  }
+  solving = false;
+
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+PortfolioSolver::PortfolioSolver (int solvers) {
+  REQUIRE (solvers >= 0, "negative number of solvers '%d'", solvers);
+  portfolio = new Portfolio (solvers ? solvers : hardware_threads ());
+}
+
+PortfolioSolver::~PortfolioSolver () {
+  REQUIRE (!portfolio->solving, "can not delete portfolio while solving");
+  delete portfolio;
+}
+
+void PortfolioSolver::add (int lit) {
+  REQUIRE (!portfolio->solving, "can not add literal while solving");
+  REQUIRE (lit != INT_MIN, "invalid literal '%d'", lit);
+  portfolio->clauses.push_back (lit);
+  const int idx = abs (lit);
+  if (idx > portfolio->max_var) portfolio->max_var = idx;
+}
+
+void PortfolioSolver::assume (int lit) {
+  REQUIRE (!portfolio->solving, "can not assume literal while solving");
+  REQUIRE (lit && lit != INT_MIN, "invalid literal '%d'", lit);
+  portfolio->assumptions.push_back (lit);
+  const int idx = abs (lit);
+  if (idx > portfolio->max_var) portfolio->max_var = idx;
+}
+
+int PortfolioSolver::solve () {
+  REQUIRE (!portfolio->solving, "already solving");
+  REQUIRE (portfolio->clauses.empty () || !portfolio->clauses.back (),
+    "clause incomplete (terminating zero not added)");
+  REQUIRE (!(portfolio->sharesize || portfolio->interval) ||
+           !portfolio->checking (),
+    "can not share clauses or run deterministically while checking proofs");
+  return portfolio->solve ();
+}
+
+int PortfolioSolver::val (int lit) {
+  REQUIRE (portfolio->res == 10, "can only get value if satisfiable");
+  return portfolio->solvers[portfolio->winner]->val (lit);
+}
+
+bool PortfolioSolver::failed (int lit) {
+  REQUIRE (portfolio->res == 20, "can only get failed if unsatisfiable");
+  return portfolio->solvers[portfolio->winner]->failed (lit);
+}
+
+void PortfolioSolver::terminate () { portfolio->done = true; }
+
+void PortfolioSolver::connect_terminator (Terminator * terminator) {
+  REQUIRE (!portfolio->solving, "can not connect terminator while solving");
+  REQUIRE (terminator, "can not connect zero terminator");
+  portfolio->terminator = terminator;
+}
+
+void PortfolioSolver::disconnect_terminator () {
+  REQUIRE (!portfolio->solving,
+    "can not disconnect terminator while solving");
+  portfolio->terminator = 0;
+}
+
+bool PortfolioSolver::set (const char * name, int val) {
+  REQUIRE (!portfolio->solving, "can not set option while solving");
+  bool res = true;
+  for (auto solver : portfolio->solvers)
+    if (!solver->set (name, val)) res = false;
+  return res;
+}
+
+void PortfolioSolver::share (int size, int glue) {
+  REQUIRE (!portfolio->solving, "can not change sharing while solving");
+  REQUIRE (0 <= size && (uint64_t) size < ClauseRing::capacity,
+    "invalid maximum shared clause size '%d'", size);
+  REQUIRE (0 <= glue, "invalid maximum shared glue '%d'", glue);
+  portfolio->share (size, glue);
+}
+
+void PortfolioSolver::deterministic (int conflicts) {
+  REQUIRE (!portfolio->solving,
+    "can not change deterministic mode while solving");
+  REQUIRE (0 <= conflicts, "invalid number of conflicts '%d'", conflicts);
+  portfolio->interval = conflicts;
+}
+
+int PortfolioSolver::vars () { return portfolio->max_var; }
+int PortfolioSolver::size () { return portfolio->solvers.size (); }
+int PortfolioSolver::status () { return portfolio->res; }
+int PortfolioSolver::winner () { return portfolio->winner; }
+
+Solver * PortfolioSolver::solver (int idx) {
+  REQUIRE (0 <= idx && idx < size (), "invalid solver index '%d'", idx);
+  return portfolio->solvers[idx];
+}
+
+}
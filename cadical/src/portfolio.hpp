@@ -0,0 +1,147 @@
+#ifndef _portfolio_hpp_INCLUDED
+#define _portfolio_hpp_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+class Solver;
+class Terminator;
+class Learner;
+class Importer;
+
+// Each solver of a portfolio exports its short learned clauses to its own
+// ring buffer, which all other solvers read at restarts without locking.
+// A clause is stored as its size followed by its literals.  Since there is
+// only one writer, it first reserves the space, then writes the literals
+// and finally publishes them by moving 'head'.  Readers keep their own
+// position and validate after reading a clause that the writer has not
+// reserved space overlapping with it in the mean time (as in a sequence
+// lock).  Readers which are lapped by the writer skip to the head and
+// thus might miss clauses, which is fine for clause sharing.  The literals
+// are stored inline and all atomics are lock-free, thus rings can also be
+// placed in memory shared between processes (see 'ProcessPortfolio').
+
+struct ClauseRing {
+
+  static const uint64_t capacity = 1u << 16;
+
+  atomic<uint64_t> reserved;
+  atomic<uint64_t> head;
+  atomic<int> lits[capacity];
+
+  ClauseRing () : reserved (0), head (0) { }
+
+  void push (const vector<int> & clause);
+  bool read (uint64_t & position, vector<int> & clause);
+};
+
+// Importers filter duplicated clauses, e.g., the same unit learned by
+// several solvers, by hashing the sorted literals of the clause.
+
+struct ClauseFilter {
+
+  unordered_set<uint64_t> imported;
+  vector<int> sorted;
+
+  uint64_t hash (const vector<int> & clause);
+  bool fresh (const vector<int> & clause);
+};
+
+// Plain clause sharing through rings as used by the process portfolio and
+// 'solve_many'.  Learned clauses with at most 'size' literals are exported
+// to the own ring and clauses are imported from all other rings.
+
+struct RingLearner : public Learner {
+  ClauseRing * ring;
+  const int size;
+  vector<int> clause;
+  RingLearner (ClauseRing * r, int s) : ring (r), size (s) { }
+  bool learning (int clause_size);
+  void learn (int lit);
+};
+
+struct RingImporter : public Importer {
+  const vector<ClauseRing*> rings;
+  const size_t self;
+  vector<uint64_t> positions;
+  ClauseFilter filter;
+  RingImporter (const vector<ClauseRing*> & r, size_t idx) :
+    rings (r), self (idx), positions (r.size (), 0) { }
+  bool import (vector<int> & clause);
+};
+
+// Shared state of a 'PortfolioSolver'.  The formula is kept in 'clauses'
+// as zero terminated literal sequences until every solver has copied it,
+// which happens at the beginning of each 'solve' call in parallel.  While
+// solving all the solvers have a connected terminator which just checks
+// the 'done' flag.  In deterministic mode the rings are not used.  Then
+// learned clauses are collected per solver in 'exported' (again as zero
+// terminated literal sequences) and copied to 'pending' of all the other
+// solvers between rounds.  Each solver still runs a single 'solve' call.
+// Its importer ends the round at the first restart after the conflict
+// boundary of the round and waits in 'barrier' until all other running
+// solvers arrived there too.  The last one to arrive (or to finish)
+// completes the round.  If a solver finished in this round, all solvers
+// are stopped, and otherwise the clauses are exchanged.  The importers are
+// only connected if clauses are shared or in deterministic mode.
+
+struct Portfolio {
+
+  vector<Solver*> solvers;
+  vector<Terminator*> terminators;
+  vector<Learner*> learners;    // exporting to 'rings'
+  vector<Importer*> importers;  // importing from 'rings'
+  vector<ClauseRing*> rings;    // one per solver
+
+  int sharesize;                // maximum size of shared clauses
+
+  int interval;                 // conflicts per round (0=asynchronous)
+  vector<vector<int>> exported; // learned in current round (per solver)
+  vector<vector<int>> pending;  // to be imported in this round (per solver)
+
+  vector<int> clauses;          // not yet copied clauses
+  vector<int> assumptions;      // for the next 'solve' call
+  int max_var;
+
+  Terminator * terminator;      // external terminator (or zero)
+
+  atomic<bool> solving;
+  atomic<bool> done;            // forces solvers to terminate
+  atomic<int> running;          // number of still running solvers
+
+  mutex lock;                   // protects 'winner', 'res' and
+  condition_variable finished;  // signals finished solvers
+
+  int arrived;                  // solvers waiting in 'barrier'
+  int64_t rounds;               // completed rounds
+  condition_variable completed; // signals completed rounds
+
+  int winner;                   // solver which determined 'res'
+  int res;                      // result of last 'solve' call
+
+  Portfolio (int size);
+  ~Portfolio ();
+
+  static void diversify (Solver *, int idx);
+  void share (int size, int glue);
+  bool checking ();
+  void work (int idx);
+  int64_t conflicts (int idx);
+  void synchronize ();
+  void complete ();
+  bool barrier ();
+  int solve ();
+};
+
+}
+
+#endif
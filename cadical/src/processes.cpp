@@ -0,0 +1,356 @@
+#include "internal.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Workers are stopped through the 'done' flag in the shared segment, which
+// is set by the winner or by the parent process.
+
+struct ProcessTerminator : public Terminator {
+  ProcessShared * shared;
+  ProcessTerminator (ProcessShared * s) : shared (s) { }
+  bool terminate () { return shared->done; }
+};
+
+/*------------------------------------------------------------------------*/
+
+ProcessPortfolio::ProcessPortfolio (int s) :
+  size (s), sharesize (8), shareglue (2), max_var (0), terminator (0),
+  shared (0), bytes (0), solving (false), interrupted (false),
+  winner (-1), res (0)
+{
+  assert (size > 0);
+}
+
+// The shared segment starts with the header followed by the rings, the
+// model and the failed flags, each starting at a cache line.
+
+static size_t align (size_t bytes) { return (bytes + 63) & ~(size_t) 63; }
+
+ClauseRing * ProcessPortfolio::ring (int idx) {
+  assert (shared);
+  assert (0 <= idx && idx < size);
+  char * start = (char *) shared + align (sizeof (ProcessShared));
+  return (ClauseRing *) (start + idx * align (sizeof (ClauseRing)));
+}
+
+signed char * ProcessPortfolio::values () {
+  return (signed char *) ring (0) + size * align (sizeof (ClauseRing));
+}
+
+signed char * ProcessPortfolio::flags () {
+  return values () + align (max_var + 1);
+}
+
+// The name of the segment is removed right after creating it.  The mapping
+// stays valid in the parent and is inherited by the forked workers, and
+// the segment is freed as soon as all these processes unmapped it, even if
+// they crash.  On failure 'error' is set and false returned.
+
+bool ProcessPortfolio::map () {
+  static atomic<unsigned> segments (0);
+  char name[64];
+  snprintf (name, sizeof name,
+    "/cadical-%d-%u", (int) getpid (), segments++);
+  bytes = align (sizeof (ProcessShared));
+  bytes += size * align (sizeof (ClauseRing));
+  bytes += 2 * align (max_var + 1);
+  char msg[128];
+  const int fd = shm_open (name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) {
+    snprintf (msg, sizeof msg,
+      "can not create shared memory segment '%s'", name);
+    error = msg;
+    return false;
+  }
+  shm_unlink (name);
+  if (ftruncate (fd, bytes)) {
+    close (fd);
+    snprintf (msg, sizeof msg,
+      "can not resize shared memory segment to %zd bytes", bytes);
+    error = msg;
+    return false;
+  }
+  void * ptr = mmap (0, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+  if (ptr == MAP_FAILED) {
+    snprintf (msg, sizeof msg,
+      "can not map shared memory segment of %zd bytes", bytes);
+    error = msg;
+    return false;
+  }
+  shared = new (ptr) ProcessShared ();
+  shared->done = false;
+  shared->claimed = -1;
+  shared->res = 0;
+  shared->winner = -1;
+  for (int idx = 0; idx < size; idx++)
+    new (ring (idx)) ClauseRing ();
+  return true;
+}
+
+void ProcessPortfolio::unmap () {
+  assert (shared);
+  munmap (shared, bytes);
+  shared = 0;
+  bytes = 0;
+}
+
+// Number of threads of the calling process, which is counted in the
+// '/proc' file system if available and otherwise assumed to be one.
+
+int ProcessPortfolio::threads () {
+  DIR * dir = opendir ("/proc/self/task");
+  if (!dir) return 1;
+  int res = 0;
+  while (struct dirent * entry = readdir (dir))
+    if (entry->d_name[0] != '.') res++;
+  closedir (dir);
+  return res ? res : 1;
+}
+
+// Imported clauses can not be checked (see 'Solver::connect_importer').
+// The options are only recorded here and thus replayed on a fresh solver.
+
+bool ProcessPortfolio::checking () {
+  Solver solver;
+  for (const auto & option : options)
+    solver.set (option.first.c_str (), option.second);
+  return solver.get ("check") && solver.get ("checkproof");
+}
+
+/*------------------------------------------------------------------------*/
+
+// Runs in the forked worker process, which inherited the formula.  The
+// first worker with a result claims the right to publish it, then writes
+// its model or failed assumptions and 'res' to the shared segment and only
+// then sets 'winner'.  Thus if it crashes in between the parent does not
+// see a winner and does not copy an incomplete result.
+
+void ProcessPortfolio::work (int idx) {
+  Solver * solver = new Solver ();
+  Portfolio::diversify (solver, idx);
+  solver->set ("exportglue", shareglue);
+  for (const auto & option : options)
+    solver->set (option.first.c_str (), option.second);
+  ProcessTerminator connected (shared);
+  vector<ClauseRing*> rings;
+  for (int i = 0; i < size; i++)
+    rings.push_back (ring (i));
+  RingLearner learner (rings[idx], sharesize);
+  RingImporter importer (rings, idx);
+  solver->connect_terminator (&connected);
+  solver->connect_learner (&learner);
+  if (sharesize) solver->connect_importer (&importer);
+  for (const auto & lit : clauses)
+    solver->add (lit);
+  for (const auto & lit : assumptions)
+    solver->assume (lit);
+  const int tmp = solver->solve ();
+  if (!tmp) return;
+  int expected = -1;
+  if (shared->claimed.compare_exchange_strong (expected, idx)) {
+    if (tmp == 10) {
+      signed char * model = values ();
+      for (int lit = 1; lit <= max_var; lit++)
+        model[lit] = solver->val (lit) > 0 ? 1 : -1;
+    } else {
+      signed char * failed = flags ();
+      for (const auto & lit : assumptions)
+        if (solver->failed (lit))
+          failed[abs (lit)] |= lit > 0 ? 1 : 2;
+    }
+    shared->res = tmp;
+    shared->winner = idx;
+  }
+  shared->done = true;
+}
+
+// Workers leave through '_exit' without deleting their solver, since the
+// process is going away anyhow and it should not run 'atexit' handlers of
+// the parent (for instance of the Python interpreter).  If forking fails
+// the already forked workers are stopped and waited for.  Workers killed
+// by a signal or exiting with a non-zero status are reported in 'error'
+// and 'solve' returns zero if none of the remaining workers determined the
+// result.
+
+int ProcessPortfolio::solve () {
+
+  winner = -1;
+  res = 0;
+  error.clear ();
+  interrupted = false;
+
+  if (!map ()) {
+    assumptions.clear ();
+    return 0;
+  }
+
+  solving = true;
+
+  fflush (stdout);
+  fflush (stderr);
+
+  char msg[128];
+  vector<pid_t> workers;
+  for (int idx = 0; idx < size; idx++) {
+    const pid_t pid = fork ();
+    if (pid < 0) {
+      snprintf (msg, sizeof msg, "failed to fork worker process %d", idx);
+      error = msg;
+      shared->done = true;
+      break;
+    }
+    if (!pid) {
+      work (idx);
+      _exit (0);
+    }
+    workers.push_back (pid);
+  }
+
+  // The external terminator is only called from the parent process.
+
+  int running = workers.size ();
+  while (running) {
+    for (size_t idx = 0; idx < workers.size (); idx++) {
+      pid_t & pid = workers[idx];
+      if (!pid) continue;
+      int status;
+      if (waitpid (pid, &status, WNOHANG) != pid) continue;
+      pid = 0;
+      running--;
+      if (WIFEXITED (status) && !WEXITSTATUS (status)) continue;
+      if (!error.empty ()) continue;
+      if (WIFSIGNALED (status))
+        snprintf (msg, sizeof msg,
+          "worker process %zd killed by signal %d", idx, WTERMSIG (status));
+      else
+        snprintf (msg, sizeof msg,
+          "worker process %zd exited with status %d",
+          idx, WEXITSTATUS (status));
+      error = msg;
+    }
+    if (!running) break;
+    if (!shared->done &&
+        (interrupted || (terminator && terminator->terminate ())))
+      shared->done = true;
+    usleep (10000);
+  }
+
+  winner = shared->winner;
+  if (winner >= 0) {
+    res = shared->res;
+    const signed char * begin = res == 10 ? values () : flags ();
+    vector<signed char> & copy = res == 10 ? model : failed;
+    copy.assign (begin, begin + max_var + 1);
+  }
+
+  unmap ();
+  assumptions.clear ();
+  solving = false;
+
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+ProcessPortfolioSolver::ProcessPortfolioSolver (int solvers) {
+  REQUIRE (solvers >= 0, "negative number of solvers '%d'", solvers);
+  portfolio = new ProcessPortfolio (solvers ? solvers : hardware_threads ());
+}
+
+ProcessPortfolioSolver::~ProcessPortfolioSolver () {
+  REQUIRE (!portfolio->solving, "can not delete portfolio while solving");
+  delete portfolio;
+}
+
+void ProcessPortfolioSolver::add (int lit) {
+  REQUIRE (!portfolio->solving, "can not add literal while solving");
+  REQUIRE (lit != INT_MIN, "invalid literal '%d'", lit);
+  portfolio->clauses.push_back (lit);
+  const int idx = abs (lit);
+  if (idx > portfolio->max_var) portfolio->max_var = idx;
+}
+
+void ProcessPortfolioSolver::assume (int lit) {
+  REQUIRE (!portfolio->solving, "can not assume literal while solving");
+  REQUIRE (lit && lit != INT_MIN, "invalid literal '%d'", lit);
+  portfolio->assumptions.push_back (lit);
+  const int idx = abs (lit);
+  if (idx > portfolio->max_var) portfolio->max_var = idx;
+}
+
+int ProcessPortfolioSolver::solve () {
+  REQUIRE (!portfolio->solving, "already solving");
+  REQUIRE (portfolio->clauses.empty () || !portfolio->clauses.back (),
+    "clause incomplete (terminating zero not added)");
+  REQUIRE (ProcessPortfolio::threads () == 1,
+    "can not fork workers from multi-threaded process");
+  REQUIRE (!portfolio->sharesize || !portfolio->checking (),
+    "can not share clauses while checking proofs");
+  return portfolio->solve ();
+}
+
+int ProcessPortfolioSolver::val (int lit) {
+  REQUIRE (portfolio->res == 10, "can only get value if satisfiable");
+  REQUIRE (lit && lit != INT_MIN, "invalid literal '%d'", lit);
+  const int idx = abs (lit);
+  if (idx >= (int) portfolio->model.size ()) return -idx;
+  return (portfolio->model[idx] > 0) == (lit > 0) ? idx : -idx;
+}
+
+bool ProcessPortfolioSolver::failed (int lit) {
+  REQUIRE (portfolio->res == 20, "can only get failed if unsatisfiable");
+  REQUIRE (lit && lit != INT_MIN, "invalid literal '%d'", lit);
+  const int idx = abs (lit);
+  if (idx >= (int) portfolio->failed.size ()) return false;
+  return portfolio->failed[idx] & (lit > 0 ? 1 : 2);
+}
+
+void ProcessPortfolioSolver::terminate () { portfolio->interrupted = true; }
+
+void ProcessPortfolioSolver::connect_terminator (Terminator * terminator) {
+  REQUIRE (!portfolio->solving, "can not connect terminator while solving");
+  REQUIRE (terminator, "can not connect zero terminator");
+  portfolio->terminator = terminator;
+}
+
+void ProcessPortfolioSolver::disconnect_terminator () {
+  REQUIRE (!portfolio->solving,
+    "can not disconnect terminator while solving");
+  portfolio->terminator = 0;
+}
+
+bool ProcessPortfolioSolver::set (const char * name, int val) {
+  REQUIRE (!portfolio->solving, "can not set option while solving");
+  if (!Solver::is_valid_option (name)) return false;
+  portfolio->options.push_back ({string (name), val});
+  return true;
+}
+
+void ProcessPortfolioSolver::share (int size, int glue) {
+  REQUIRE (!portfolio->solving, "can not change sharing while solving");
+  REQUIRE (0 <= size && (uint64_t) size < ClauseRing::capacity,
+    "invalid maximum shared clause size '%d'", size);
+  REQUIRE (0 <= glue, "invalid maximum shared glue '%d'", glue);
+  portfolio->sharesize = size;
+  portfolio->shareglue = glue;
+}
+
+int ProcessPortfolioSolver::vars () { return portfolio->max_var; }
+int ProcessPortfolioSolver::size () { return portfolio->size; }
+int ProcessPortfolioSolver::status () { return portfolio->res; }
+int ProcessPortfolioSolver::winner () { return portfolio->winner; }
+
+const char * ProcessPortfolioSolver::error () {
+  return portfolio->error.empty () ? 0 : portfolio->error.c_str ();
+}
+
+}
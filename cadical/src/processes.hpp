@@ -0,0 +1,84 @@
+#ifndef _processes_hpp_INCLUDED
+#define _processes_hpp_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+class Terminator;
+struct ClauseRing;
+
+// Header of the memory shared between the parent and the worker processes
+// of a 'ProcessPortfolio'.  It is followed by one clause ring per worker,
+// the model of the winner and its failed assumption flags, both indexed by
+// variable.  All fields are lock-free atomics, since the worker
+// processes write them concurrently.
+
+struct ProcessShared {
+  atomic<bool> done;            // forces workers to terminate
+  atomic<int> claimed;          // worker allowed to publish its result
+  atomic<int> res;              // result of the winner
+  atomic<int> winner;           // set after the result is published
+};
+
+// State of a 'ProcessPortfolioSolver'.  The formula, assumptions and the
+// options set through the API are kept in the parent process.  Each 'solve'
+// call creates a POSIX shared memory segment and forks one worker process
+// per solver, which inherits the formula copy-on-write, solves it with the
+// same diversified configuration as in a 'Portfolio' and exchanges short
+// learned clauses through the rings in the shared segment.  The parent
+// waits for all workers, asks the external terminator in the mean time and
+// copies the model or failed assumptions of the winner before the segment
+// is unmapped again.  Thus workers do not keep learned clauses across
+// 'solve' calls.  Since the workers are forked without 'exec' and then
+// allocate memory, the calling process has to be single-threaded.  If the
+// segment can not be created, a worker can not be forked or a worker
+// crashes, then 'error' describes the (first) failure.
+
+struct ProcessPortfolio {
+
+  int size;                     // number of worker processes
+  int sharesize;                // maximum size of shared clauses
+  int shareglue;                // maximum glue of shared clauses
+
+  vector<pair<string, int>> options;    // set through the API
+  vector<int> clauses;          // all clauses (zero terminated)
+  vector<int> assumptions;      // for the next 'solve' call
+  int max_var;
+
+  Terminator * terminator;      // external terminator (or zero)
+
+  ProcessShared * shared;       // mapped during 'solve' (or zero)
+  size_t bytes;                 // size of shared segment
+  bool solving;
+  atomic<bool> interrupted;     // asynchronous 'terminate' call
+
+  int winner;                   // worker which determined 'res'
+  int res;                      // result of last 'solve' call
+  vector<signed char> model;    // of the winner (indexed by variable)
+  vector<signed char> failed;   // bit 1 = 'idx' and bit 2 = '-idx' failed
+  string error;                 // of last 'solve' call (empty if none)
+
+  ProcessPortfolio (int size);
+
+  ClauseRing * ring (int idx);
+  signed char * values ();
+  signed char * flags ();
+
+  static int threads ();
+  bool checking ();
+  bool map ();
+  void unmap ();
+  void work (int idx);
+  int solve ();
+};
+
+}
+
+#endif
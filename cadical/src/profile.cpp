@@ -16,11 +16,32 @@ Profiles::Profiles (Internal * s)
 {
 }
 
+// Hardware performance counters are opened lazily by the first profile
+// started after enabling them, thus in the thread running the solver.
+
+bool Internal::profiling_hardware () {
+  if (!opts.profilehw) return false;
+  if (perf.tried) return perf.opened;
+  if (perf.open ()) MSG ("opened hardware performance counters");
+  else WARNING ("hardware performance counters not available");
+  return perf.opened;
+}
+
+static void
+accumulate_events (Profile & profile, const uint64_t * now) {
+  for (int i = 0; i < Perf::EVENTS; i++) {
+    if (now[i] > profile.begin[i])
+      profile.events[i] += now[i] - profile.begin[i];
+    profile.begin[i] = now[i];
+  }
+}
+
 void Internal::start_profiling (Profile & profile, double s) {
   assert (profile.level <= opts.profile);
   assert (!profile.active);
   profile.started = s;
   profile.active = true;
+  if (profiling_hardware ()) perf.read (profile.begin);
 }
 
 void Internal::stop_profiling (Profile & profile, double s) {
@@ -28,10 +49,17 @@ void Internal::stop_profiling (Profile & profile, double s) {
   assert (profile.active);
   profile.value += s - profile.started;
   profile.active = false;
+  if (!profiling_hardware ()) return;
+  uint64_t now[Perf::EVENTS];
+  perf.read (now);
+  accumulate_events (profile, now);
 }
 
 double Internal::update_profiles () {
   double now = time ();
+  uint64_t events[Perf::EVENTS];
+  const bool hardware = profiling_hardware ();
+  if (hardware) perf.read (events);
 # define PROFILE(NAME,LEVEL) \
 do { \
   Profile & profile = profiles.NAME; \
@@ -39,6 +67,7 @@ do { \
     assert (profile.level <= opts.profile); \
     profile.value += now - profile.started; \
     profile.started = now; \
+    if (hardware) accumulate_events (profile, events); \
   } \
 } while (0);
   PROFILES
@@ -101,6 +130,53 @@ do { \
   MSG ("");
   PRT ("last line shows %s time for solving", time_type);
   PRT ("(percentage relative to total %s time)", time_type);
+
+  if (!perf.opened) return;
+
+  // Same order as above, i.e., sorted by time, but now showing hardware
+  // events in millions and instructions per cycle ('ipc').  A low number
+  // of instructions per cycle together with many cache misses suggests
+  // that the procedure is memory bound.
+
+  SECTION ("hardware performance counters");
+  MSG ("%smillions of events counted by individual solving procedures%s",
+    tout.magenta_code (), tout.normal_code ());
+  MSG ("");
+  MSG ("%10s %10s %6s %10s %10s", "cycles", "instrs", "ipc",
+    "cachemiss", "branchmiss");
+  for (size_t i = 0; i < n; i++) {
+    const uint64_t * e = profs[i]->events;
+    MSG ("%10.2f %10.2f %6.2f %10.2f %10.2f %s",
+      e[Perf::CYCLES] * 1e-6, e[Perf::INSTRUCTIONS] * 1e-6,
+      relative (e[Perf::INSTRUCTIONS], e[Perf::CYCLES]),
+      e[Perf::CACHE_MISSES] * 1e-6, e[Perf::BRANCH_MISSES] * 1e-6,
+      profs[i]->name);
+  }
+  const uint64_t * e = profiles.solve.events;
+  MSG ("  =================================================");
+  MSG ("%10.2f %10.2f %6.2f %10.2f %10.2f solve",
+    e[Perf::CYCLES] * 1e-6, e[Perf::INSTRUCTIONS] * 1e-6,
+    relative (e[Perf::INSTRUCTIONS], e[Perf::CYCLES]),
+    e[Perf::CACHE_MISSES] * 1e-6, e[Perf::BRANCH_MISSES] * 1e-6);
+}
+
+// Unlike 'update_profiles' this does not change the profiles, since it
+// might be called from another thread while solving.  Instead the time of
+// the current interval of active profiles is added to the reported value.
+
+bool Internal::traverse_profiles (StatisticsIterator & it) {
+  const double now = time ();
+#define PROFILE(NAME,LEVEL) \
+do { \
+  if (LEVEL > opts.profile) break; \
+  const Profile & p = profiles.NAME; \
+  double value = p.value; \
+  if (p.active) value += now - p.started; \
+  if (!it.time (#NAME, value)) return false; \
+} while (0);
+  PROFILES
+#undef PROFILE
+  return true;
 }
 
 }
@@ -89,8 +89,15 @@ struct Profile {
   const char * name; // name of the profiled function (or 'phase')
   const int level;   // allows to cheaply test if profiling is enabled
 
+  uint64_t events[Perf::EVENTS];  // accumulated hardware events
+  uint64_t begin[Perf::EVENTS];   // hardware events when started
+
   Profile (const char * n, int l) :
-    active (false), value (0), name (n), level (l) { }
+    active (false), value (0), name (n), level (l)
+  {
+    for (int i = 0; i < Perf::EVENTS; i++)
+      events[i] = begin[i] = 0;
+  }
 };
 
 struct Profiles {
@@ -159,12 +166,14 @@ do { \
   ) \
   set_mode (SIMPLIFY); \
   set_mode (M); \
+  BEGIN_EVENT (#S); \
 } while (0)
 
 /*------------------------------------------------------------------------*/
 
 #define STOP_SIMPLIFIER(S,M) \
 do { \
+  END_EVENT (#S); \
   NON_QUIET_PROFILE_CODE ( \
     const double N = time (); \
     const int L = internal->opts.profile; \
@@ -206,6 +215,7 @@ do { \
       internal->start_profiling (internal->profiles.walk, N); \
   ) \
   set_mode (WALK); \
+  BEGIN_EVENT ("walk"); \
 } while (0)
 
 /*------------------------------------------------------------------------*/
@@ -213,6 +223,7 @@ do { \
 
 #define STOP_INNER_WALK() \
 do { \
+  END_EVENT ("walk"); \
   require_mode (SEARCH); \
   assert (!preprocessing); \
   reset_mode (WALK); \
@@ -239,6 +250,7 @@ do { \
     START (walk); \
   ) \
   set_mode (WALK); \
+  BEGIN_EVENT ("walk"); \
 } while (0)
 
 /*------------------------------------------------------------------------*/
@@ -246,6 +258,7 @@ do { \
 
 #define STOP_OUTER_WALK() \
 do { \
+  END_EVENT ("walk"); \
   require_mode (SEARCH); \
   assert (!preprocessing); \
   reset_mode (WALK); \
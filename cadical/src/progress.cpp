@@ -0,0 +1,62 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// The name of the innermost phase the solver currently is in.  Some
+// simplifiers run within others, e.g., 'subsume' and 'block' within 'elim'
+// or 'decompose' and 'ternary' within 'probe', thus these are checked
+// first.
+
+const char * Internal::phase_name () const {
+  if (lookingahead) return "lookahead";
+  if (in_mode (WALK)) return "walk";
+  if (in_mode (LUCKY)) return "lucky";
+  if (in_mode (BLOCK)) return "block";
+  if (in_mode (CONDITION)) return "condition";
+  if (in_mode (COVER)) return "cover";
+  if (in_mode (DECOMP)) return "decompose";
+  if (in_mode (DEDUP)) return "deduplicate";
+  if (in_mode (SUBSUME)) return "subsume";
+  if (in_mode (TERNARY)) return "ternary";
+  if (in_mode (TRANSRED)) return "transred";
+  if (in_mode (VIVIFY)) return "vivify";
+  if (in_mode (PROBE)) return "probe";
+  if (in_mode (ELIM)) return "elim";
+  if (in_mode (SIMPLIFY)) return "simplify";
+  if (in_mode (SEARCH)) return "search";
+  return "idle";
+}
+
+// Checking the wall clock time is costly too, thus it is only done in the
+// same intervals as calling the terminator.  The next call-back is
+// scheduled relative to the current call to avoid bursts of calls after
+// long stretches without any check.
+
+void Internal::notify_progress (int factor) {
+  assert (external->progress);
+  assert (factor > 0);
+  assert (INT_MAX/factor > opts.terminateint);
+  lim.progress.check = factor * opts.terminateint;
+  const double now = real_time ();
+  if (now < lim.progress.time) return;
+  lim.progress.time = now + 1e-3 * external->progressint;
+  ProgressMetrics metrics;
+  metrics.time = now;
+  metrics.conflicts = stats.conflicts;
+  metrics.decisions = stats.decisions;
+  metrics.propagations = stats.propagations.search;
+  metrics.learned = stats.learned.clauses;
+  metrics.redundant = stats.current.redundant;
+  metrics.irredundant = stats.current.irredundant;
+  metrics.trail = trail.size ();
+  metrics.level = level;
+  metrics.fast_glue = averages.current.glue.fast;
+  metrics.slow_glue = averages.current.glue.slow;
+  metrics.stable = stable;
+  metrics.phase = phase_name ();
+  metrics.memory = current_resident_set_size ();
+  LOG ("calling progress call-back at %.2f seconds", now);
+  external->progress->progress (metrics);
+}
+
+}
@@ -152,12 +152,20 @@ bool Internal::propagate () {
   //
   int64_t before = propagated;
 
+  // Sampling hotspots is checked only once per propagated literal if it is
+  // disabled (see 'hotspots.hpp').
+  //
+  const bool sampling = opts.hotspots && !searching_lucky_phases;
+
   while (!conflict && propagated != trail.size ()) {
 
     const int lit = -trail[propagated++];
     LOG ("propagating %d", -lit);
     Watches & ws = watches (lit);
 
+    const bool sampled = sampling && !--hotspots.countdown;
+    if (sampled) sample_variable (lit);
+
     const const_watch_iterator eow = ws.end ();
     watch_iterator j = ws.begin ();
     const_watch_iterator i = j;
@@ -196,6 +204,8 @@ bool Internal::propagate () {
         // to access the clause at all (only during conflict analysis, and
         // there also only to simplify the code).
 
+        if (sampled) sample_clause (w.clause, 0);
+
         if (b < 0) conflict = w.clause;          // but continue ...
         else search_assign (w.blit, w.clause);
 
@@ -224,8 +234,10 @@ bool Internal::propagate () {
         const int other = lits[0] ^ lits[1] ^ lit;
         const signed char u = val (other); // value of the other watch
 
-        if (u > 0) j[-1].blit = other; // satisfied, just replace blit
-        else {
+        if (u > 0) {
+          j[-1].blit = other; // satisfied, just replace blit
+          if (sampled) sample_clause (w.clause, 0);
+        } else {
 
           // This follows Ian Gent's (JAIR'13) idea of saving the position
           // of the last watch replacement.  In essence it needs two copies
@@ -260,6 +272,13 @@ bool Internal::propagate () {
 
           assert (lits + 2 <= k), assert (k <= w.clause->end ());
 
+          // Number of literals inspected in the two searches above.
+          //
+          if (sampled)
+            sample_clause (w.clause,
+              v < 0 ? size - 2 : k >= middle ? k - middle + 1
+                                : (end - middle) + (k - lits - 1));
+
           if (v > 0) {
 
             // Replacement satisfied, so just replace 'blit'.
@@ -14,7 +14,8 @@ namespace CaDiCaL {
 bool Internal::reducing () {
   if (!opts.reduce) return false;
   if (!stats.current.redundant) return false;
-  return stats.conflicts >= lim.reduce;
+  if (stats.conflicts >= lim.reduce) return true;
+  return memory_limit_approached ();
 }
 
 /*------------------------------------------------------------------------*/
@@ -165,20 +166,33 @@ bool Internal::propagate_out_of_order_units () {
 
 void Internal::reduce () {
   START (reduce);
+  BEGIN_EVENT ("reduce");
 
-  stats.reductions++;
+  // Reducing before the regular limit is only triggered by the memory
+  // limit (see 'memory_limit_approached'), in which case we flush all
+  // recently unused redundant clauses.  These reductions are only counted
+  // in 'memlimited' since the regular reduce interval and the probing
+  // schedule depend on 'reductions', which thus should not change.
+  //
+  const bool pressure = stats.conflicts < lim.reduce;
+  if (pressure) stats.memlimited++;
+  else stats.reductions++;
   report ('.', 1);
 
-  bool flush = flushing ();
+  bool flush = !pressure && flushing ();
   if (flush) stats.flush.count++;
 
   if (!propagate_out_of_order_units ()) goto DONE;
 
   mark_satisfied_clauses_as_garbage ();
   protect_reasons ();
-  if (flush) mark_clauses_to_be_flushed ();
+  if (flush || pressure) mark_clauses_to_be_flushed ();
   else mark_useless_redundant_clauses_as_garbage ();
   garbage_collection ();
+  if (pressure) {
+    shrink_memory ();
+    goto DONE;
+  }
 
   {
     int64_t delta = opts.reduceint * (stats.reductions + 1);
@@ -205,7 +219,8 @@ void Internal::reduce () {
 
 DONE:
 
-  report (flush ? 'f' : '-');
+  report (pressure ? 'm' : flush ? 'f' : '-');
+  END_EVENT ("reduce");
   STOP (reduce);
 }
 
@@ -102,6 +102,7 @@ char Internal::rephase_walk () {
 
 void Internal::rephase () {
 
+  BEGIN_EVENT ("rephase");
   stats.rephased.total++;
   PHASE ("rephase", stats.rephased.total,
     "reached rephase limit %" PRId64 " after %" PRId64 " conflicts",
@@ -224,6 +225,7 @@ void Internal::rephase () {
 
   if (stable) shuffle_scores ();
   else shuffle_queue ();
+  END_EVENT ("rephase");
 }
 
 }
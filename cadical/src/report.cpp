@@ -48,6 +48,7 @@ p  failed literal probing round (lower case 'p')
 .  before reducing redundant clauses
 f  flushed redundant clauses
 -  reduced redundant clauses
+m  reduced redundant clauses due to memory limit
 ~  start of resetting phases
 R  restart
 s  subsumed clause removal round
@@ -22,6 +22,7 @@ bool Internal::stabilizing () {
     report (stable ? ']' : '}');
     if (stable) STOP (stable);
     else        STOP (unstable);
+    END_EVENT (stable ? "stable" : "unstable");
     stable = !stable;
     if (stable) stats.stabphases++;
     PHASE ("stabilizing", stats.stabphases,
@@ -40,6 +41,7 @@ bool Internal::stabilizing () {
     report (stable ? '[' : '{');
     if (stable) START (stable);
     else        START (unstable);
+    BEGIN_EVENT (stable ? "stable" : "unstable");
   }
   return stable;
 }
@@ -93,16 +95,19 @@ int Internal::reuse_trail () {
 
 void Internal::restart () {
   START (restart);
+  BEGIN_EVENT ("restart");
   stats.restarts++;
   stats.restartlevels += level;
   if (stable) stats.restartstable++;
   LOG ("restart %" PRId64 "", stats.restarts);
   backtrack (reuse_trail ());
+  if (external->importer) import_clauses ();
 
   lim.restart = stats.conflicts + opts.restartint;
   LOG ("new restart limit at %" PRId64 " conflicts", lim.restart);
 
   report ('R', 2);
+  END_EVENT ("restart");
   STOP (restart);
 }
 
@@ -0,0 +1,97 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Names of statistics, histograms and profiles are string literals or
+// kept in 'Histograms::names', thus can be copied as pointers.
+
+struct SnapshotRecorder : public StatisticsIterator {
+  vector<Snapshot::Entry> & entries;
+  SnapshotRecorder (vector<Snapshot::Entry> & e) : entries (e) { }
+  bool counter (const char * name, int64_t value) {
+    entries.push_back ({name, false, value, 0});
+    return true;
+  }
+  bool time (const char * name, double seconds) {
+    entries.push_back ({name, true, 0, seconds});
+    return true;
+  }
+};
+
+const int Snapshot::timeout;
+
+bool Snapshot::traverse (const vector<Entry> & entries,
+                         StatisticsIterator & it) {
+  for (const auto & e : entries)
+    if (e.time ? !it.time (e.name, e.seconds)
+               : !it.counter (e.name, e.counter)) return false;
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::traverse_statistics (StatisticsIterator & it) {
+  bool res = it.time ("process", process_time ()) &&
+             it.time ("real", real_time ()) &&
+             stats.traverse (it) &&
+             histograms.traverse (it);
+#ifndef QUIET
+  if (res) res = traverse_profiles (it);
+#endif
+  return res;
+}
+
+// Called by the solving thread at a safe point if a reader requested a
+// copy.  The copy is recorded before taking the lock in order to keep
+// readers waiting as short as possible.
+
+void Internal::publish_snapshot () {
+  vector<Snapshot::Entry> entries;
+  entries.reserve (snapshot.entries.size ());
+  SnapshotRecorder recorder (entries);
+  (void) traverse_statistics (recorder);
+  lock_guard<mutex> guard (snapshot.lock);
+  snapshot.entries.swap (entries);
+  snapshot.generation++;
+  snapshot.requested = false;
+  snapshot.published.notify_all ();
+}
+
+void Internal::start_publishing () {
+  lock_guard<mutex> guard (snapshot.lock);
+  assert (!snapshot.solving);
+  snapshot.solving = true;
+}
+
+// Readers still waiting for a copy traverse the statistics directly after
+// solving stopped.
+
+void Internal::stop_publishing () {
+  lock_guard<mutex> guard (snapshot.lock);
+  assert (snapshot.solving);
+  snapshot.solving = false;
+  snapshot.requested = false;
+  snapshot.published.notify_all ();
+}
+
+bool Internal::traverse_snapshot (StatisticsIterator & it) {
+  vector<Snapshot::Entry> entries;
+  {
+    unique_lock<mutex> guard (snapshot.lock);
+    if (snapshot.solving) {
+      const int64_t generation = snapshot.generation;
+      snapshot.requested = true;
+      snapshot.published.wait_for (guard,
+        chrono::milliseconds (Snapshot::timeout), [&] {
+          return !snapshot.solving || snapshot.generation != generation;
+        });
+    }
+    if (!snapshot.solving) return traverse_statistics (it);
+    entries = snapshot.entries;
+  }
+  return Snapshot::traverse (entries, it);
+}
+
+}
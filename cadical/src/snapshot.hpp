@@ -0,0 +1,51 @@
+#ifndef _snapshot_hpp_INCLUDED
+#define _snapshot_hpp_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+class StatisticsIterator;
+
+// Copy of all statistics published by the solving thread for readers in
+// other threads (see 'Solver::traverse_statistics').  While the solver is
+// in 'solve' a reader sets 'requested' and waits until the solver
+// publishes a fresh copy at its next check for termination, which is a
+// safe point where no counter is updated.  If the solver does not reach
+// such a point within 'timeout' milliseconds the previous copy is used.
+// Outside of 'solve' the statistics are traversed directly while holding
+// 'lock', which keeps the solver from starting to solve concurrently.
+// Thus there is no cost without readers except for polling 'requested'.
+
+struct Snapshot {
+
+  static const int timeout = 100;       // milliseconds
+
+  struct Entry {
+    const char * name;          // persistent names of statistics
+    bool time;                  // 'seconds' instead of 'counter'
+    int64_t counter;
+    double seconds;
+  };
+
+  mutex lock;                   // protects all but 'requested'
+  condition_variable published; // notified after publishing (or solving)
+  atomic<bool> requested;       // polled while solving
+  bool solving;                 // readers need to request a copy
+  int64_t generation;           // number of published copies
+  vector<Entry> entries;        // last published copy
+
+  Snapshot () : requested (false), solving (false), generation (0) { }
+
+  static bool traverse (const vector<Entry> &, StatisticsIterator &);
+};
+
+}
+
+#endif
@@ -560,6 +560,91 @@ Solver::CubesWithStatus Solver::generate_cubes (int depth) {
   return cubes2;
 }
 
+int Solver::solve_cubed (int depth, int threads) {
+  LOG_API_CALL_BEGIN ("solve_cubed", depth);
+  REQUIRE_READY_STATE ();
+  REQUIRE (depth >= 0, "negative cube depth '%d'", depth);
+  REQUIRE (threads >= 0, "negative number of threads '%d'", threads);
+  if (!threads) threads = hardware_threads ();
+  transition_to_unknown_state ();
+
+  // Split this solver only until there are enough cubes for all workers.
+
+  int top = 0;
+  while (top < depth && (1 << top) < threads)
+    top++;
+
+  const vector<int> assumptions = external->assumptions;
+  auto generated = generate_cubes (top);
+
+  int res;
+  if (generated.status) res = solve ();
+  else {
+    if (generated.cubes.empty ())
+      generated.cubes.push_back (assumptions);
+    Conquer conquer (this, threads, depth - top,
+                     internal->opts.conquerlimit, external->terminator);
+    res = conquer.solve (generated.cubes);
+    internal->stats.conquer.cubes += conquer.cubes;
+    internal->stats.conquer.refuted += conquer.refuted;
+    internal->stats.conquer.stolen += conquer.stolen;
+    internal->stats.conquer.resplit += conquer.resplit;
+    reset_assumptions ();
+
+    // The result of the workers is confirmed on this solver in order to
+    // set its state (model or failed assumptions).  This is cheap, since
+    // it only propagates, but must not be interrupted by the terminator,
+    // which might have asked the workers to stop already, nor by a forced
+    // termination requested while the workers were running.
+
+    Terminator * terminator = external->terminator;
+    external->terminator = 0;
+    internal->termination_forced = false;
+    if (res == 10) {
+      for (const auto & lit : conquer.model)
+        assume (lit);
+      res = solve ();
+      assert (res == 10);
+    } else if (res == 20) {
+      for (const auto & lit : assumptions)
+        add (-lit);
+      add (0);
+      for (const auto & lit : assumptions)
+        assume (lit);
+      res = solve ();
+      assert (res == 20);
+    }
+    external->terminator = terminator;
+  }
+  LOG_API_CALL_RETURNS ("solve_cubed", depth, res);
+  return res;
+}
+
+Solver::ResultsWithCores
+Solver::solve_many (const vector<vector<int>> & queries, int threads) {
+  LOG_API_CALL_BEGIN ("solve_many", (int) queries.size ());
+  REQUIRE_READY_STATE ();
+  REQUIRE (threads >= 0, "negative number of threads '%d'", threads);
+  for (const auto & query : queries)
+    for (const auto & lit : query)
+      REQUIRE_VALID_LIT (lit);
+  if (!threads) threads = hardware_threads ();
+  if ((size_t) threads > queries.size ())
+    threads = max ((size_t) 1, queries.size ());
+  ResultsWithCores res;
+  if (!queries.empty ()) {
+    Batch batch (this, threads, internal->opts.batchshare,
+                 queries, external->terminator);
+    batch.solve ();
+    internal->stats.batch.queries += queries.size ();
+    internal->stats.batch.refuted += batch.refuted;
+    res.results = move (batch.results);
+    res.cores = move (batch.cores);
+  }
+  LOG_API_CALL_END ("solve_many", (int) queries.size ());
+  return res;
+}
+
 void Solver::reset_assumptions () {
   TRACE ("reset_assumptions");
   REQUIRE_VALID_STATE ();
@@ -574,7 +659,9 @@ int Solver::call_external_solve_and_check_results (bool preprocess_only) {
   transition_to_unknown_state ();
   assert (state () & READY);
   STATE (SOLVING);
+  internal->start_publishing ();
   const int res = external->solve (preprocess_only);
+  internal->stop_publishing ();
        if (res == 10) STATE (SATISFIED);
   else if (res == 20) STATE (UNSATISFIED);
   else                STATE (UNKNOWN);
@@ -604,6 +691,7 @@ int Solver::call_external_solve_and_check_results (bool preprocess_only) {
 int Solver::solve () {
   TRACE ("solve");
   REQUIRE_READY_STATE ();
+  REQUIRE_NO_IMPORT_WHILE_PROVING ();
   const int res = call_external_solve_and_check_results (false);
   LOG_API_CALL_RETURNS ("solve", res);
   return res;
@@ -614,6 +702,7 @@ int Solver::simplify (int rounds) {
   REQUIRE_READY_STATE ();
   REQUIRE (rounds >= 0,
     "negative number of simplification rounds '%d'", rounds);
+  REQUIRE_NO_IMPORT_WHILE_PROVING ();
   internal->limit ("preprocessing", rounds);
   const int res = call_external_solve_and_check_results (true);
   LOG_API_CALL_RETURNS ("simplify", rounds, res);
@@ -734,6 +823,64 @@ void Solver::disconnect_learner () {
   LOG_API_CALL_END ("disconnect_learner");
 }
 
+void Solver::connect_importer (Importer * importer) {
+  LOG_API_CALL_BEGIN ("connect_importer");
+  REQUIRE_VALID_STATE ();
+  REQUIRE (importer, "can not connect zero importer");
+#ifdef LOGGING
+  if (external->importer)
+    LOG ("connecting new importer (disconnecting previous one)");
+  else
+    LOG ("connecting new importer (no previous one)");
+#endif
+  external->importer = importer;
+  LOG_API_CALL_END ("connect_importer");
+}
+
+void Solver::disconnect_importer () {
+  LOG_API_CALL_BEGIN ("disconnect_importer");
+  REQUIRE_VALID_STATE ();
+#ifdef LOGGING
+    if (external->importer)
+      LOG ("disconnecting previous importer");
+    else
+      LOG ("ignoring to disconnect importer (no previous one)");
+#endif
+  external->importer = 0;
+  LOG_API_CALL_END ("disconnect_importer");
+}
+
+void Solver::connect_progress (Progress * progress, int interval) {
+  LOG_API_CALL_BEGIN ("connect_progress", interval);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (progress, "can not connect zero progress call-back");
+  REQUIRE (interval >= 0, "negative progress interval '%d'", interval);
+#ifdef LOGGING
+  if (external->progress)
+    LOG ("connecting new progress call-back (disconnecting previous one)");
+  else
+    LOG ("connecting new progress call-back (no previous one)");
+#endif
+  external->progress = progress;
+  external->progressint = interval;
+  internal->lim.progress.check = 0;
+  internal->lim.progress.time = 0;
+  LOG_API_CALL_END ("connect_progress", interval);
+}
+
+void Solver::disconnect_progress () {
+  LOG_API_CALL_BEGIN ("disconnect_progress");
+  REQUIRE_VALID_STATE ();
+#ifdef LOGGING
+    if (external->progress)
+      LOG ("disconnecting previous progress call-back");
+    else
+      LOG ("ignoring to disconnect progress call-back (no previous one)");
+#endif
+  external->progress = 0;
+  LOG_API_CALL_END ("disconnect_progress");
+}
+
 /*===== IPASIR END =======================================================*/
 
 int Solver::active () const {
@@ -922,6 +1069,116 @@ void Solver::resources () {
   LOG_API_CALL_END ("resources");
 }
 
+// Might be called from another thread while solving, which changes the
+// state concurrently, thus the state is not checked here.
+
+bool Solver::traverse_statistics (StatisticsIterator & it) const {
+  LOG_API_CALL_BEGIN ("traverse_statistics");
+  REQUIRE_INITIALIZED ();
+  bool res = internal->traverse_snapshot (it);
+  LOG_API_CALL_RETURNS ("traverse_statistics", res);
+  return res;
+}
+
+bool Solver::traverse_memory (StatisticsIterator & it) const {
+  LOG_API_CALL_BEGIN ("traverse_memory");
+  REQUIRE_VALID_STATE ();
+  Memory memory;
+  internal->account_memory (memory);
+  bool res = memory.traverse (it);
+  LOG_API_CALL_RETURNS ("traverse_memory", res);
+  return res;
+}
+
+// Times are traversed before and after the counters, thus they are kept
+// until all counters are written and then written at the end.
+
+struct StatisticsWriter : public StatisticsIterator {
+  File * file;
+  int counters, times;
+  vector<pair<const char *, double>> buffered;
+  StatisticsWriter (File * f) : file (f), counters (0), times (0) { }
+  bool member (const char * name, int count) {
+    if (!file->put (count ? ",\n    \"" : "\n    \"")) return false;
+    if (!file->put (name)) return false;
+    return file->put ("\": ");
+  }
+  bool counter (const char * name, int64_t value) {
+    if (!counters && !file->put ("{\n  \"counters\": {")) return false;
+    if (!member (name, counters++)) return false;
+    return file->put (value);
+  }
+  bool time (const char * name, double seconds) {
+    buffered.push_back ({name, seconds});
+    return true;
+  }
+  bool finish () {
+    if (!counters && !file->put ("{\n  \"counters\": {")) return false;
+    if (!file->put ("\n  },\n  \"times\": {")) return false;
+    char buffer[32];
+    for (const auto & t : buffered) {
+      if (!member (t.first, times++)) return false;
+      snprintf (buffer, sizeof buffer, "%.6f", t.second);
+      if (!file->put (buffer)) return false;
+    }
+    return file->put ("\n  }\n}\n");
+  }
+};
+
+const char * Solver::write_statistics (const char * path) {
+  LOG_API_CALL_BEGIN ("write_statistics", path);
+  REQUIRE_VALID_STATE ();
+  File * file = File::write (internal, path);
+  const char * res = 0;
+  if (file) {
+    StatisticsWriter writer (file);
+    if (!traverse_statistics (writer) || !writer.finish ())
+      res = internal->error_message.init (
+              "writing to statistics file '%s' failed", path);
+    delete file;
+  } else res = internal->error_message.init (
+                 "failed to open statistics file '%s' for writing", path);
+  LOG_API_CALL_RETURNS ("write_statistics", path, res);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Solver::traverse_hotspots (HotspotIterator & it, int limit) const {
+  LOG_API_CALL_BEGIN ("traverse_hotspots", limit);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (limit >= 0, "negative limit '%d'", limit);
+  bool res = internal->traverse_hotspots (it, limit);
+  LOG_API_CALL_RETURNS ("traverse_hotspots", res);
+  return res;
+}
+
+void Solver::hotspots (int limit) {
+  LOG_API_CALL_BEGIN ("hotspots", limit);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (limit >= 0, "negative limit '%d'", limit);
+  internal->print_hotspots (limit);
+  LOG_API_CALL_END ("hotspots", limit);
+}
+
+/*------------------------------------------------------------------------*/
+
+const char * Solver::write_events (const char * path) {
+  LOG_API_CALL_BEGIN ("write_events", path);
+  REQUIRE_VALID_STATE ();
+  File * file = File::write (internal, path);
+  const char * res = 0;
+  if (file) {
+    if (!internal->write_events (file))
+      res = internal->error_message.init (
+              "writing to events file '%s' failed", path);
+    delete file;
+  } else res = internal->error_message.init (
+                 "failed to open events file '%s' for writing", path);
+  LOG_API_CALL_RETURNS ("write_events", path, res);
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 const char * Solver::read_dimacs (File * file, int & vars, int strict,
@@ -1217,6 +1474,35 @@ void Solver::copy (Solver & other) const {
 
 /*------------------------------------------------------------------------*/
 
+// API traces do not know about formulas, thus the attached clauses are
+// traced as if they were added one by one after reserving the variables.  Since 'assume' leaves the
+// 'ADDING' state a clause might still be pending even in a ready state,
+// which then would be merged with the first attached clause.
+
+void Solver::attach (const Formula & formula) {
+  LOG_API_CALL_BEGIN ("attach");
+  REQUIRE_READY_STATE ();
+  REQUIRE (internal->original.empty (),
+    "clause incomplete (terminating zero not added)");
+  REQUIRE (!external->base, "formula already attached");
+  const int * lits = formula.literals ();
+  const size_t size = formula.size ();
+  REQUIRE (!size || !lits[size-1],
+    "clause incomplete (terminating zero not added)");
+#ifndef NTRACING
+  if (trace_api_file) {
+    trace_api_call ("reserve", formula.vars ());
+    for (size_t i = 0; i < size; i++)
+      trace_api_call ("add", lits[i]);
+  }
+#endif
+  transition_to_unknown_state ();
+  external->attach (formula);
+  LOG_API_CALL_END ("attach");
+}
+
+/*------------------------------------------------------------------------*/
+
 void Solver::section (const char * title) {
   if (state () == DELETING) return;
 #ifdef QUIET
@@ -15,6 +15,16 @@ Stats::Stats () {
 
 /*------------------------------------------------------------------------*/
 
+bool Stats::traverse (StatisticsIterator & it) const {
+#define STATISTIC(NAME) \
+  if (!it.counter (#NAME, NAME)) return false;
+  STATISTICS
+#undef STATISTIC
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
 #define PRT(FMT,...) \
 do { \
   if (FMT[0] == ' ' && !all) break; \
@@ -58,6 +68,7 @@ void Stats::print (Internal * internal) {
   if (all || stats.blocked) {
   PRT ("blocked:         %15" PRId64 "   %10.2f %%  of irredundant clauses", stats.blocked, percent (stats.blocked, stats.added.irredundant));
   PRT ("  blockings:     %15" PRId64 "   %10.2f    internal", stats.blockings, relative (stats.conflicts, stats.blockings));
+  PRT ("  blockclean:    %15" PRId64 "   %10.2f %%  of blockings", stats.clean.block, percent (stats.clean.block, stats.blockings + stats.clean.block));
   PRT ("  candidates:    %15" PRId64 "   %10.2f    per blocking ", stats.blockcands, relative (stats.blockcands, stats.blockings));
   PRT ("  blockres:      %15" PRId64 "   %10.2f    per candidate", stats.blockres, relative (stats.blockres, stats.blockcands));
   PRT ("  pure:          %15" PRId64 "   %10.2f %%  of all variables", stats.all.pure, percent (stats.all.pure, stats.vars));
@@ -93,10 +104,16 @@ void Stats::print (Internal * internal) {
   PRT ("decisions:       %15" PRId64 "   %10.2f    per second", stats.decisions, relative (stats.decisions, t));
   PRT ("  searched:      %15" PRId64 "   %10.2f    per decision", stats.searched, relative (stats.searched, stats.decisions));
   }
+  if (all || stats.conquer.cubes) {
+  PRT ("cubes:           %15" PRId64 "   %10.2f %%  refuted", stats.conquer.cubes, percent (stats.conquer.refuted, stats.conquer.cubes));
+  PRT ("  cubesstolen:   %15" PRId64 "   %10.2f %%  of cubes", stats.conquer.stolen, percent (stats.conquer.stolen, stats.conquer.cubes));
+  PRT ("  cubesresplit:  %15" PRId64 "   %10.2f %%  of cubes", stats.conquer.resplit, percent (stats.conquer.resplit, stats.conquer.cubes));
+  }
   if (all || stats.all.eliminated) {
   PRT ("eliminated:      %15" PRId64 "   %10.2f %%  of all variables", stats.all.eliminated, percent (stats.all.eliminated, stats.vars));
   PRT ("  elimphases:    %15" PRId64 "   %10.2f    interval", stats.elimphases, relative (stats.conflicts, stats.elimphases));
   PRT ("  elimrounds:    %15" PRId64 "   %10.2f    per phase", stats.elimrounds, relative (stats.elimrounds, stats.elimphases));
+  PRT ("  elimclean:     %15" PRId64 "   %10.2f %%  of elimrounds", stats.clean.elim, percent (stats.clean.elim, stats.elimrounds + stats.clean.elim));
   PRT ("  elimtried:     %15" PRId64 "   %10.2f %%  eliminated", stats.elimtried, percent (stats.all.eliminated, stats.elimtried));
   PRT ("  elimgates:     %15" PRId64 "   %10.2f %%  gates per tried", stats.elimgates, percent (stats.elimgates, stats.elimtried));
   PRT ("  elimequivs:    %15" PRId64 "   %10.2f %%  equivalence gates", stats.elimequivs, percent (stats.elimequivs, stats.elimgates));
@@ -128,6 +145,11 @@ void Stats::print (Internal * internal) {
   PRT ("  hyper:         %15" PRId64 "   %10.2f %%  per conflict", stats.flush.hyper, relative (stats.flush.hyper, stats.conflicts));
   PRT ("  flushings:     %15" PRId64 "   %10.2f    interval", stats.flush.count, relative (stats.conflicts, stats.flush.count));
   }
+  if (all || stats.imported.clauses) {
+  PRT ("imported:        %15" PRId64 "   %10.2f    per restart", stats.imported.clauses, relative (stats.imported.clauses, stats.restarts));
+  PRT ("  importedunits: %15" PRId64 "   %10.2f %%  of imported", stats.imported.units, percent (stats.imported.units, stats.imported.clauses));
+  PRT ("  importskipped: %15" PRId64 "   %10.2f %%  of imported", stats.imported.skipped, percent (stats.imported.skipped, stats.imported.clauses));
+  }
   if (all || stats.instantiated) {
   PRT ("instantiated:    %15" PRId64 "   %10.2f %%  of tried", stats.instantiated, percent (stats.instantiated, stats.instried));
   PRT ("  instrounds:    %15" PRId64 "   %10.2f %%  of elimrounds", stats.instrounds, percent (stats.instrounds, stats.elimrounds));
@@ -161,12 +183,18 @@ void Stats::print (Internal * internal) {
   PRT ("  transredprops: %15" PRId64 "   %10.2f %%  of propagations", stats.propagations.transred, percent (stats.propagations.transred, propagations));
   PRT ("  vivifyprops:   %15" PRId64 "   %10.2f %%  of propagations", stats.propagations.vivify, percent (stats.propagations.vivify, propagations));
   PRT ("  walkprops:     %15" PRId64 "   %10.2f %%  of propagations", stats.propagations.walk, percent (stats.propagations.walk, propagations));
+  if (all || stats.batch.queries) {
+  PRT ("queries:         %15" PRId64 "   %10.2f %%  refuted", stats.batch.queries, percent (stats.batch.refuted, stats.batch.queries));
+  }
   if (all || stats.reactivated) {
   PRT ("reactivated:     %15" PRId64 "   %10.2f %%  of all variables", stats.reactivated, percent (stats.reactivated, stats.vars));
   }
   if (all || stats.reduced) {
   PRT ("reduced:         %15" PRId64 "   %10.2f %%  per conflict", stats.reduced, percent (stats.reduced, stats.conflicts));
   PRT ("  reductions:    %15" PRId64 "   %10.2f    interval", stats.reductions, relative (stats.conflicts, stats.reductions));
+  if (all || stats.memlimited) {
+  PRT ("  memlimited:    %15" PRId64 "   %10.2f    interval", stats.memlimited, relative (stats.conflicts, stats.memlimited));
+  }
   PRT ("  collections:   %15" PRId64 "   %10.2f    interval", stats.collections, relative (stats.conflicts, stats.collections));
   }
   if (all || stats.rephased.total) {
@@ -203,9 +231,11 @@ void Stats::print (Internal * internal) {
   PRT ("subsumed:        %15" PRId64 "   %10.2f %%  of all clauses", stats.subsumed, percent (stats.subsumed, stats.added.total));
   PRT ("  subsumephases: %15" PRId64 "   %10.2f    interval", stats.subsumephases, relative (stats.conflicts, stats.subsumephases));
   PRT ("  subsumerounds: %15" PRId64 "   %10.2f    per phase", stats.subsumerounds, relative (stats.subsumerounds, stats.subsumephases));
+  PRT ("  subsumeclean:  %15" PRId64 "   %10.2f %%  of subsumerounds", stats.clean.subsume, percent (stats.clean.subsume, stats.subsumerounds + stats.clean.subsume));
   PRT ("  deduplicated:  %15" PRId64 "   %10.2f %%  per subsumed", stats.deduplicated, percent (stats.deduplicated, stats.subsumed));
   PRT ("  transreds:     %15" PRId64 "   %10.2f    interval", stats.transreds, relative (stats.conflicts, stats.transreds));
   PRT ("  transitive:    %15" PRId64 "   %10.2f %%  per subsumed", stats.transitive, percent (stats.transitive, stats.subsumed));
+  PRT ("  transredcyc:   %15" PRId64 "   %10.2f %%  per transreds", stats.transredcyclic, percent (stats.transredcyclic, stats.transreds));
   PRT ("  subirr:        %15" PRId64 "   %10.2f %%  of subsumed", stats.subirr, percent (stats.subirr, stats.subsumed));
   PRT ("  subred:        %15" PRId64 "   %10.2f %%  of subsumed", stats.subred, percent (stats.subred, stats.subsumed));
   PRT ("  subtried:      %15" PRId64 "   %10.2f    tried per subsumed", stats.subtried, relative (stats.subtried, stats.subsumed));
@@ -224,6 +254,7 @@ void Stats::print (Internal * internal) {
   if (all || stats.htrs) {
   PRT ("ternary:         %15" PRId64 "   %10.2f %%  of resolved", stats.htrs, percent (stats.htrs, stats.ternres));
   PRT ("  phases:        %15" PRId64 "   %10.2f    interval", stats.ternary, relative (stats.conflicts, stats.ternary));
+  PRT ("  ternclean:     %15" PRId64 "   %10.2f %%  of phases", stats.clean.ternary, percent (stats.clean.ternary, stats.ternary + stats.clean.ternary));
   PRT ("  htr3:          %15" PRId64 "   %10.2f %%  ternary hyper ternres", stats.htrs3, percent (stats.htrs3, stats.htrs));
   PRT ("  htr2:          %15" PRId64 "   %10.2f %%  binary hyper ternres", stats.htrs2, percent (stats.htrs2, stats.htrs));
   }
@@ -276,6 +307,10 @@ void Internal::print_resource_usage () {
   MSG ("total process time since initialization: %12.2f    seconds", internal->process_time ());
   MSG ("total real time since initialization:    %12.2f    seconds", internal->real_time ());
   MSG ("maximum resident set size of process:    %12.2f    MB", m/(double)(1l<<20));
+  Memory memory;
+  account_memory (memory);
+  MSG ("accounted memory of solver:              %12.2f    MB", memory.total ()/(double)(1l<<20));
+  memory.print (internal);
 #endif
 }
 
@@ -6,6 +6,7 @@
 namespace CaDiCaL {
 
 struct Internal;
+class StatisticsIterator;
 
 struct Stats {
 
@@ -46,6 +47,25 @@ struct Stats {
     int64_t ternary;    // ternary marked variables
   } mark;
 
+  struct {
+    int64_t block;      // blockings without marked literals
+    int64_t elim;       // elimination rounds without marked variables
+    int64_t subsume;    // subsumption rounds with less than two marked
+    int64_t ternary;    // ternary phases without marked variables
+  } clean;
+
+  struct {
+    int64_t cubes;      // cubes generated in 'solve_cubed'
+    int64_t refuted;    // cubes shown to be unsatisfiable
+    int64_t stolen;     // cubes stolen from other workers
+    int64_t resplit;    // cubes split after reaching conflict limit
+  } conquer;
+
+  struct {
+    int64_t queries;    // assumption sets solved in 'solve_many'
+    int64_t refuted;    // queries shown to be unsatisfiable
+  } batch;
+
   struct {
     int64_t total;
     int64_t redundant;
@@ -93,6 +113,12 @@ struct Stats {
 
   int64_t compacts;     // number of compactifications
   int64_t shuffled;     // shuffled queues and scores
+  struct {
+    int64_t clauses;    // imported clauses (including units)
+    int64_t units;      // imported units
+    int64_t skipped;    // satisfied or with inactive variables
+  } imported;
+
   int64_t restarts;     // actual number of happened restarts
   int64_t restartlevels;// levels at restart
   int64_t restartstable;// actual number of happened restarts
@@ -112,6 +138,7 @@ struct Stats {
   int64_t recomputed;   // recomputed glues 'recompute_glue'
   int64_t searched;     // searched decisions in 'decide'
   int64_t reductions;   // 'reduce' counter
+  int64_t memlimited;   // extra reductions forced by memory limit
   int64_t reduced;      // number of reduced clauses
   int64_t collected;    // number of collected bytes
   int64_t collections;  // number of garbage collections
@@ -170,6 +197,7 @@ struct Stats {
   int64_t vivifystred3; // strengthened redundant clause (3)
   int64_t vivifyunits;  // units during vivification
   int64_t transreds;
+  int64_t transredcyclic;
   int64_t transitive;
   struct {
     int64_t literals;
@@ -219,10 +247,213 @@ struct Stats {
   Stats ();
 
   void print (Internal *);
+  bool traverse (StatisticsIterator &) const;
 };
 
 /*------------------------------------------------------------------------*/
 
+// All counters of 'Stats' for traversing them with their name, e.g.,
+// through 'Solver::traverse_statistics'.  If you add a counter to 'Stats'
+// add it here too.
+
+#define STATISTICS \
+STATISTIC(vars) \
+STATISTIC(conflicts) \
+STATISTIC(decisions) \
+STATISTIC(propagations.cover) \
+STATISTIC(propagations.instantiate) \
+STATISTIC(propagations.probe) \
+STATISTIC(propagations.search) \
+STATISTIC(propagations.transred) \
+STATISTIC(propagations.vivify) \
+STATISTIC(propagations.walk) \
+STATISTIC(condassinit) \
+STATISTIC(condassirem) \
+STATISTIC(condassrem) \
+STATISTIC(condassvars) \
+STATISTIC(condautinit) \
+STATISTIC(condautrem) \
+STATISTIC(condcands) \
+STATISTIC(condcondinit) \
+STATISTIC(condcondrem) \
+STATISTIC(conditioned) \
+STATISTIC(conditionings) \
+STATISTIC(condprops) \
+STATISTIC(mark.block) \
+STATISTIC(mark.elim) \
+STATISTIC(mark.subsume) \
+STATISTIC(mark.ternary) \
+STATISTIC(clean.block) \
+STATISTIC(clean.elim) \
+STATISTIC(clean.subsume) \
+STATISTIC(clean.ternary) \
+STATISTIC(conquer.cubes) \
+STATISTIC(conquer.refuted) \
+STATISTIC(conquer.stolen) \
+STATISTIC(conquer.resplit) \
+STATISTIC(batch.queries) \
+STATISTIC(batch.refuted) \
+STATISTIC(current.total) \
+STATISTIC(current.redundant) \
+STATISTIC(current.irredundant) \
+STATISTIC(added.total) \
+STATISTIC(added.redundant) \
+STATISTIC(added.irredundant) \
+STATISTIC(cover.count) \
+STATISTIC(cover.asymmetric) \
+STATISTIC(cover.blocked) \
+STATISTIC(cover.total) \
+STATISTIC(lucky.tried) \
+STATISTIC(lucky.succeeded) \
+STATISTIC(lucky.constant.one) \
+STATISTIC(lucky.constant.zero) \
+STATISTIC(lucky.forward.one) \
+STATISTIC(lucky.forward.zero) \
+STATISTIC(lucky.backward.one) \
+STATISTIC(lucky.backward.zero) \
+STATISTIC(lucky.horn.positive) \
+STATISTIC(lucky.horn.negative) \
+STATISTIC(rephased.total) \
+STATISTIC(rephased.best) \
+STATISTIC(rephased.flipped) \
+STATISTIC(rephased.inverted) \
+STATISTIC(rephased.original) \
+STATISTIC(rephased.random) \
+STATISTIC(rephased.walk) \
+STATISTIC(walk.count) \
+STATISTIC(walk.broken) \
+STATISTIC(walk.flips) \
+STATISTIC(walk.minimum) \
+STATISTIC(flush.count) \
+STATISTIC(flush.learned) \
+STATISTIC(flush.hyper) \
+STATISTIC(compacts) \
+STATISTIC(shuffled) \
+STATISTIC(imported.clauses) \
+STATISTIC(imported.units) \
+STATISTIC(imported.skipped) \
+STATISTIC(restarts) \
+STATISTIC(restartlevels) \
+STATISTIC(restartstable) \
+STATISTIC(stabphases) \
+STATISTIC(stabconflicts) \
+STATISTIC(rescored) \
+STATISTIC(reused) \
+STATISTIC(reusedlevels) \
+STATISTIC(reusedstable) \
+STATISTIC(sections) \
+STATISTIC(chrono) \
+STATISTIC(backtracks) \
+STATISTIC(improvedglue) \
+STATISTIC(promoted1) \
+STATISTIC(promoted2) \
+STATISTIC(bumped) \
+STATISTIC(recomputed) \
+STATISTIC(searched) \
+STATISTIC(reductions) \
+STATISTIC(memlimited) \
+STATISTIC(reduced) \
+STATISTIC(collected) \
+STATISTIC(collections) \
+STATISTIC(hbrs) \
+STATISTIC(hbrsizes) \
+STATISTIC(hbreds) \
+STATISTIC(hbrsubs) \
+STATISTIC(instried) \
+STATISTIC(instantiated) \
+STATISTIC(instrounds) \
+STATISTIC(subsumed) \
+STATISTIC(deduplicated) \
+STATISTIC(deduplications) \
+STATISTIC(strengthened) \
+STATISTIC(elimotfstr) \
+STATISTIC(subirr) \
+STATISTIC(subred) \
+STATISTIC(subtried) \
+STATISTIC(subchecks) \
+STATISTIC(subchecks2) \
+STATISTIC(elimotfsub) \
+STATISTIC(subsumerounds) \
+STATISTIC(subsumephases) \
+STATISTIC(eagertried) \
+STATISTIC(eagersub) \
+STATISTIC(elimres) \
+STATISTIC(elimrestried) \
+STATISTIC(elimrounds) \
+STATISTIC(elimphases) \
+STATISTIC(elimcompleted) \
+STATISTIC(elimtried) \
+STATISTIC(elimsubst) \
+STATISTIC(elimgates) \
+STATISTIC(elimequivs) \
+STATISTIC(elimands) \
+STATISTIC(elimites) \
+STATISTIC(elimxors) \
+STATISTIC(elimbwsub) \
+STATISTIC(elimbwstr) \
+STATISTIC(ternary) \
+STATISTIC(ternres) \
+STATISTIC(htrs) \
+STATISTIC(htrs2) \
+STATISTIC(htrs3) \
+STATISTIC(decompositions) \
+STATISTIC(vivifications) \
+STATISTIC(vivifychecks) \
+STATISTIC(vivifydecs) \
+STATISTIC(vivifyreused) \
+STATISTIC(vivifysched) \
+STATISTIC(vivifysubs) \
+STATISTIC(vivifystrs) \
+STATISTIC(vivifystrirr) \
+STATISTIC(vivifystred1) \
+STATISTIC(vivifystred2) \
+STATISTIC(vivifystred3) \
+STATISTIC(vivifyunits) \
+STATISTIC(transreds) \
+STATISTIC(transredcyclic) \
+STATISTIC(transitive) \
+STATISTIC(learned.literals) \
+STATISTIC(learned.clauses) \
+STATISTIC(minimized) \
+STATISTIC(irrbytes) \
+STATISTIC(garbage) \
+STATISTIC(units) \
+STATISTIC(binaries) \
+STATISTIC(probingphases) \
+STATISTIC(probingrounds) \
+STATISTIC(probesuccess) \
+STATISTIC(probed) \
+STATISTIC(failed) \
+STATISTIC(hyperunary) \
+STATISTIC(probefailed) \
+STATISTIC(transredunits) \
+STATISTIC(blockings) \
+STATISTIC(blocked) \
+STATISTIC(blockres) \
+STATISTIC(blockcands) \
+STATISTIC(blockpured) \
+STATISTIC(blockpurelits) \
+STATISTIC(extensions) \
+STATISTIC(extended) \
+STATISTIC(weakened) \
+STATISTIC(weakenedlen) \
+STATISTIC(restorations) \
+STATISTIC(restored) \
+STATISTIC(reactivated) \
+STATISTIC(restoredlits) \
+STATISTIC(preprocessings) \
+STATISTIC(all.fixed) \
+STATISTIC(all.eliminated) \
+STATISTIC(all.substituted) \
+STATISTIC(all.pure) \
+STATISTIC(now.fixed) \
+STATISTIC(now.eliminated) \
+STATISTIC(now.substituted) \
+STATISTIC(now.pure) \
+STATISTIC(unused) \
+STATISTIC(active) \
+STATISTIC(inactive) \
+
 }
 
 #endif
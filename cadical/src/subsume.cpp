@@ -328,6 +328,25 @@ bool Internal::subsume_round () {
   if (terminated_asynchronously ()) return false;
   if (!stats.current.redundant && !stats.current.irredundant) return false;
 
+  // Only clauses with at least two 'subsume' marked unassigned variables
+  // are scheduled below.  If there are not even two such variables on the
+  // dirty work list the round would not do anything except resetting the
+  // marks, which we can do without going over all clauses.
+  //
+  sort_dirty (dirty.subsume);
+  int marked = 0;
+  for (const auto & idx : dirty.subsume) {
+    if (!flags (idx).subsume) continue;
+    if (val (idx)) continue;
+    if (++marked > 1) break;
+  }
+  if (marked < 2) {
+    LOG ("only %d subsume marked variables", marked);
+    stats.clean.subsume++;
+    reset_subsume_bits ();
+    return false;
+  }
+
   START_SIMPLIFIER (subsume, SUBSUME);
   stats.subsumerounds++;
 
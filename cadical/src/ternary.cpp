@@ -242,21 +242,44 @@ bool Internal::ternary_round (int64_t & steps_limit, int64_t & htrs_limit) {
     terncon, percent (terncon, clauses.size ()),
     bincon, percent (bincon, clauses.size ()));
 
-  // Try ternary resolution on all variables once.
+  // Try ternary resolution on all marked variables once in the order of
+  // their index, as if going over all variables.  Resolvents added in this
+  // loop push newly marked variables to the (now empty) dirty work list.
+  // Those with a larger index than the current one are still tried in
+  // this pass, the others remain marked for the next round.
   //
-  for (auto idx : vars) {
+  vector<int> work;
+  work.swap (dirty.ternary);
+  sort_dirty (work);
+  priority_queue<int, vector<int>, greater<int> > schedule (
+    greater<int> (), work);
+  size_t pushed = 0;
+  while (!schedule.empty ()) {
     if (terminated_asynchronously ()) break;
     if (steps_limit < 0) break;
     if (htrs_limit < 0) break;
+    const int idx = schedule.top ();
+    schedule.pop ();
     ternary_idx (idx, steps_limit, htrs_limit);
+    while (pushed < dirty.ternary.size ()) {
+      const int other = dirty.ternary[pushed++];
+      if (other > idx) schedule.push (other);
+    }
   }
 
   // Gather some statistics for the verbose messages below and also
   // determine whether new variables have been marked and it would make
   // sense to run another round of ternary resolution over those variables.
+  // Still marked variables are kept on the dirty work list.
   //
+  for (const auto & idx : work)
+    if (flags (idx).ternary)
+      dirty.ternary.push_back (idx);
+  erase_vector (work);
+  sort_dirty (dirty.ternary);
+
   int remain = 0;
-  for (auto idx : vars) {
+  for (const auto & idx : dirty.ternary) {
     if (!active (idx)) continue;
     if (!flags (idx).ternary) continue;
     remain++;
@@ -287,6 +310,24 @@ bool Internal::ternary () {
   //
   if (last.ternary.marked == stats.mark.ternary) return false;
 
+  // Otherwise there still might be no active marked variable, in which
+  // case we can avoid connecting the occurrences of all clauses.
+  //
+  sort_dirty (dirty.ternary);
+  bool candidates = false;
+  for (const auto & idx : dirty.ternary) {
+    if (!active (idx)) continue;
+    if (!flags (idx).ternary) continue;
+    candidates = true;
+    break;
+  }
+  if (!candidates) {
+    LOG ("no ternary resolution candidates");
+    stats.clean.ternary++;
+    last.ternary.marked = stats.mark.ternary;
+    return false;
+  }
+
   START_SIMPLIFIER (ternary, TERNARY);
   stats.ternary++;
 
@@ -63,13 +63,22 @@ void Internal::transred () {
   //
   sort_watches ();
 
+  int64_t propagations = 0, units = 0, removed = 0;
+
+  // The bit-parallel version checks all remaining candidates (up to the
+  // limit) and thus replaces the breadth first search below, unless the
+  // binary implication graph turns out to be cyclic or too large to be
+  // ordered topologically within half of the limit.
+  //
+  if (opts.transredbits &&
+      transred_bits (limit, propagations, units, removed))
+    i = end;
+
   // This working stack plays the same role as the 'trail' during standard
   // propagation.
   //
   vector<int> work;
 
-  int64_t propagations = 0, units = 0, removed = 0;
-
   while (!unsat &&
          i != end &&
          !terminated_asynchronously () &&
@@ -193,4 +202,275 @@ void Internal::transred () {
   report ('t', !opts.reportall && !(removed + units));
 }
 
+/*------------------------------------------------------------------------*/
+
+// Bit-parallel transitive reduction ('--transredbits').  Instead of one
+// breadth first search per candidate clause we check all the candidate
+// edges leaving up to 64 source literals at once.  For every literal 'v'
+// reached from these sources we maintain bit-masks of the sources which
+// have a path of length at least one ('reach') respectively of length at
+// least two ('far') to 'v'.  Propagating these masks along the edges in
+// topological order computes them exactly.  Then an edge 'src -> dst' is
+// transitive if the bit of 'src' is set in the 'far' mask of 'dst'.  This
+// requires the binary implication graph to be acyclic though, since
+// otherwise the longer path could use the edge itself.  After equivalent
+// literal substitution ('decompose') this is usually the case, but new
+// binary clauses might have been learned since then.  Thus we first have
+// to compute a topological order and give up if a cycle is found.
+//
+// As in the breadth first search irredundant candidates can only be
+// removed using irredundant edges, which requires a second pair of masks
+// restricted to irredundant edges.  Note that all transitive edges of one
+// batch are removed together.  This is still sound, since an edge used on
+// the alternative path of another removed edge spans a strictly smaller
+// part of the topological order.  Finally, a source which reaches both a
+// literal and its negation is a failed literal.
+
+struct transred_masks {
+  uint64_t self;        // bit of this literal if it is a source
+  uint64_t reach;       // sources with path of length at least one
+  uint64_t far;         // sources with path of length at least two
+  uint64_t ireach;      // same as 'reach' but only irredundant edges
+  uint64_t ifar;        // same as 'far' but only irredundant edges
+};
+
+struct transred_candidate {
+  unsigned finished;    // finishing time of 'src' in depth first search
+  int src, dst;
+  Clause * clause;
+};
+
+struct transred_candidate_rank {
+  bool operator () (const transred_candidate & a,
+                    const transred_candidate & b) const {
+    return a.finished > b.finished;
+  }
+};
+
+bool Internal::transred_bits (int64_t limit, int64_t & propagations,
+                              int64_t & units, int64_t & removed) {
+
+#ifndef QUIET
+  const double start = time ();
+  const int64_t before = removed;
+#endif
+
+  // Compute finishing times of an iterative depth first search.  Since
+  // edges go from later to earlier finished literals in an acyclic graph,
+  // decreasing finishing time gives a topological order.  An edge to a
+  // literal which is still open (on the current search path) closes a
+  // cycle.  The search has to traverse the whole binary implication graph
+  // before any candidate is checked.  Thus it may use at most half of the
+  // limit and otherwise is abandoned, which leaves the other half to the
+  // breadth first search (which makes progress on large graphs too).
+  //
+  const size_t size = 2 * (size_t) (max_var + 1);
+  const unsigned open = UINT_MAX;
+  const int64_t ordering_limit = propagations + limit / 2;
+  vector<unsigned> finished (size, 0);
+  vector<int> work;
+  unsigned count = 0;
+  bool cyclic = false, exhausted = false;
+
+  for (auto root : lits) {
+    if (!active (root) || val (root)) continue;
+    if (finished[vlit (root)]) continue;
+    work.push_back (root);
+    while (!cyclic && !work.empty ()) {
+      const int lit = work.back ();
+      unsigned & f = finished[vlit (lit)];
+      if (f) {
+        if (f == open) f = ++count;
+        work.pop_back ();
+        continue;
+      }
+      if (propagations >= ordering_limit) { exhausted = true; break; }
+      f = open;
+      propagations++;
+      for (const auto & w : watches (-lit)) {
+        if (!w.binary ()) break;
+        if (w.clause->garbage) continue;
+        const int other = w.blit;
+        if (val (other)) continue;
+        const unsigned g = finished[vlit (other)];
+        if (g == open) { cyclic = true; break; }
+        if (!g) work.push_back (other);
+      }
+    }
+    if (cyclic || exhausted) break;
+  }
+
+  if (exhausted) {
+    PHASE ("transred", stats.transreds,
+      "topological ordering exceeds limit, using breadth first search");
+    return false;
+  }
+
+  if (cyclic) {
+    stats.transredcyclic++;
+    PHASE ("transred", stats.transreds,
+      "binary implication graph cyclic, using breadth first search");
+    return false;
+  }
+
+  // Each candidate clause is checked in one direction only, with the
+  // source literal being the one later in topological order, and then
+  // candidates are grouped by source literal in topological order.
+  //
+  vector<transred_candidate> candidates;
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->size != 2) continue;
+    if (c->redundant && c->hyper) continue;
+    if (c->transred) continue;
+    int src = -c->literals[0];
+    int dst = c->literals[1];
+    if (val (src) || val (dst)) continue;
+    if (finished[vlit (-dst)] < finished[vlit (src)]) {
+      int tmp = dst;
+      dst = -src; src = -tmp;
+    }
+    candidates.push_back ({ finished[vlit (src)], src, dst, c });
+  }
+  stable_sort (candidates.begin (), candidates.end (),
+               transred_candidate_rank ());
+
+  vector<unsigned> slot (size, 0);      // one plus index into 'masks'
+  vector<transred_masks> masks;
+  vector<int> sources;
+
+  const auto by_finished = [&] (int a, int b) {
+    return finished[vlit (a)] > finished[vlit (b)];
+  };
+
+  size_t i = 0;
+
+  while (!unsat &&
+         i < candidates.size () &&
+         !terminated_asynchronously () &&
+         propagations < limit)
+  {
+    // Collect the next (at most) 64 source literals.
+    //
+    assert (work.empty ());
+    assert (masks.empty ());
+    assert (sources.empty ());
+    const size_t begin = i;
+    for (; i < candidates.size (); i++) {
+      const int src = candidates[i].src;
+      if (i > begin && candidates[i - 1].src == src) continue;
+      if (sources.size () == 64) break;
+      if (!val (src)) {
+        assert (!slot[vlit (src)]);
+        const uint64_t self = (uint64_t) 1 << sources.size ();
+        masks.push_back ({ self, 0, 0, 0, 0 });
+        slot[vlit (src)] = masks.size ();
+        work.push_back (src);
+      }
+      sources.push_back (src);
+    }
+
+    LOG ("transred batch of %zd sources", sources.size ());
+
+    // Find all literals reachable from these sources.
+    //
+    for (size_t j = 0; j < work.size (); j++) {
+      const int lit = work[j];
+      for (const auto & w : watches (-lit)) {
+        if (!w.binary ()) break;
+        if (w.clause->garbage) continue;
+        const int other = w.blit;
+        if (val (other)) continue;
+        unsigned & s = slot[vlit (other)];
+        if (s) continue;
+        masks.push_back ({ 0, 0, 0, 0, 0 });
+        s = masks.size ();
+        work.push_back (other);
+      }
+    }
+
+    // Propagate the masks in topological order.
+    //
+    sort (work.begin (), work.end (), by_finished);
+    for (const auto & lit : work) {
+      propagations++;
+      const transred_masks m = masks[slot[vlit (lit)] - 1];
+      for (const auto & w : watches (-lit)) {
+        if (!w.binary ()) break;
+        Clause * d = w.clause;
+        if (d->garbage) continue;
+        const int other = w.blit;
+        if (val (other)) continue;
+        assert (slot[vlit (other)]);
+        transred_masks & n = masks[slot[vlit (other)] - 1];
+        n.reach |= m.reach | m.self;
+        n.far |= m.reach;
+        if (d->redundant) continue;
+        n.ireach |= m.ireach | m.self;
+        n.ifar |= m.ireach;
+      }
+    }
+
+    // A source reaching its own negation or a literal and its negation is
+    // a failed literal.
+    //
+    uint64_t failed = 0;
+    for (const auto & lit : work) {
+      const unsigned s = slot[vlit (-lit)];
+      if (!s) continue;
+      const transred_masks & m = masks[slot[vlit (lit)] - 1];
+      failed |= (m.self | m.reach) & masks[s - 1].reach;
+    }
+
+    for (size_t j = begin; j < i; j++) {
+      const transred_candidate & t = candidates[j];
+      Clause * c = t.clause;
+      if (c->garbage) continue;
+      c->transred = true;
+      if (val (t.src) || val (t.dst)) continue;
+      assert (slot[vlit (t.src)]);
+      assert (slot[vlit (t.dst)]);
+      const transred_masks & m = masks[slot[vlit (t.src)] - 1];
+      const transred_masks & n = masks[slot[vlit (t.dst)] - 1];
+      const uint64_t far = c->redundant ? n.far : n.ifar;
+      if (!(far & m.self)) continue;
+      removed++;
+      stats.transitive++;
+      LOG (c, "transitive redundant");
+      mark_garbage (c);
+    }
+
+    for (const auto & lit : work)
+      slot[vlit (lit)] = 0;
+    work.clear ();
+    masks.clear ();
+
+    for (size_t j = 0; !unsat && j < sources.size (); j++) {
+      if (!(failed & ((uint64_t) 1 << j))) continue;
+      const int src = sources[j];
+      if (val (src)) continue;
+      units++;
+      LOG ("found failed literal %d during transitive reduction", src);
+      stats.failed++;
+      stats.transredunits++;
+      assign_unit (-src);
+      if (!propagate ()) {
+        VERBOSE (1, "propagating new unit results in conflict");
+        learn_empty_clause ();
+      }
+    }
+    sources.clear ();
+  }
+
+#ifndef QUIET
+  const double delta = time () - start;
+  PHASE ("transred", stats.transreds,
+    "bit-parallel reduction removed %" PRId64
+    " transitive clauses in %.2f seconds (%.0f per second)",
+    removed - before, delta, relative (removed - before, delta));
+#endif
+
+  return true;
+}
+
 }
@@ -4,8 +4,18 @@ namespace CaDiCaL {
 
 void Internal::reset_subsume_bits () {
   LOG ("marking all variables as not subsume");
-  for (auto idx : vars)
+  for (auto idx : dirty.subsume)
     flags (idx).subsume = false;
+  dirty.subsume.clear ();
+}
+
+// Sorting a dirty work list and removing duplicates makes simplifiers
+// schedule candidates in the same order as going over all variables.
+
+void Internal::sort_dirty (vector<int> & work) {
+  sort (work.begin (), work.end ());
+  const auto end = unique (work.begin (), work.end ());
+  work.resize (end - work.begin ());
 }
 
 void Internal::check_var_stats () {
@@ -0,0 +1,163 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (Solver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+// Random 3-SAT clauses satisfied by the 'planted' assignment, where every
+// odd variable is true and every even variable is false.
+
+static vector<vector<int>> planted (int vars, int clauses) {
+  vector<vector<int>> res;
+  unsigned state = 7;
+  auto next = [&state] () { return state = state * 1103515245u + 12345u; };
+  while ((int) res.size () < clauses) {
+    vector<int> clause;
+    bool satisfied = false;
+    for (int i = 0; i < 3; i++) {
+      const int idx = 1 + (next () >> 8) % vars;
+      const int lit = (next () >> 8) & 1 ? idx : -idx;
+      if ((lit > 0) == (idx & 1)) satisfied = true;
+      clause.push_back (lit);
+    }
+    if (satisfied) res.push_back (clause);
+  }
+  return res;
+}
+
+struct Counter : Terminator {
+  int calls = 0;
+  bool terminate () { return ++calls > 5; }
+};
+
+int main () {
+
+  {
+    Solver solver;
+    pigeon_hole (solver, 7);
+    int res = solver.solve_cubed (4, 3);
+    assert (res == 20);
+    assert (solver.state () == UNSATISFIED);
+  }
+
+  {
+    Solver solver;
+    const auto clauses = planted (200, 800);
+    for (const auto & clause : clauses) {
+      for (const auto & lit : clause) solver.add (lit);
+      solver.add (0);
+    }
+    int res = solver.solve_cubed (3, 4);
+    assert (res == 10);
+    for (const auto & clause : clauses) {
+      bool satisfied = false;
+      for (const auto & lit : clause)
+        if (solver.val (lit) > 0) satisfied = true;
+      assert (satisfied);
+    }
+
+    // Refuting all cubes under assumptions only adds the negation of the
+    // assumptions, thus the formula stays satisfiable.
+
+    solver.add (-1), solver.add (-2), solver.add (0);
+    solver.assume (1), solver.assume (2);
+    res = solver.solve_cubed (2, 2);
+    assert (res == 20);
+    assert (solver.failed (1) || solver.failed (2));
+
+    res = solver.solve_cubed (2, 1);
+    assert (res == 10);
+    assert (solver.val (1) < 0 || solver.val (2) < 0);
+  }
+
+  // Parallel lookahead scoring does not depend on the number of threads.
+
+  {
+    vector<vector<int>> cubes[2];
+    for (int i = 0; i < 2; i++) {
+      Solver solver;
+      solver.set ("lookaheadthreads", 2 + 2*i);
+      pigeon_hole (solver, 6);
+      for (const auto & clause : planted (200, 700)) {
+        for (const auto & lit : clause) solver.add (lit + (lit < 0 ? -50 : 50));
+        solver.add (0);
+      }
+      auto result = solver.generate_cubes (3);
+      assert (!result.status);
+      assert (!result.cubes.empty ());
+      cubes[i] = result.cubes;
+    }
+    assert (cubes[0] == cubes[1]);
+  }
+
+  // Only probing the best candidates of the parent cube.
+
+  {
+    Solver solver;
+    solver.set ("lookaheadtop", 4);
+    pigeon_hole (solver, 7);
+    int res = solver.solve_cubed (5, 2);
+    assert (res == 20);
+  }
+
+  // Dynamically splitting cubes which reach their conflict limit.
+
+  {
+    Solver solver;
+    solver.set ("conquerlimit", 50);
+    pigeon_hole (solver, 8);
+    int res = solver.solve_cubed (1, 3);
+    assert (res == 20);
+  }
+
+  {
+    Solver solver;
+    solver.set ("conquerlimit", 10);
+    const auto clauses = planted (300, 1250);
+    for (const auto & clause : clauses) {
+      for (const auto & lit : clause) solver.add (lit);
+      solver.add (0);
+    }
+    int res = solver.solve_cubed (1, 2);
+    assert (res == 10);
+    for (const auto & clause : clauses) {
+      bool satisfied = false;
+      for (const auto & lit : clause)
+        if (solver.val (lit) > 0) satisfied = true;
+      assert (satisfied);
+    }
+  }
+
+  {
+    Solver solver;
+    Counter counter;
+    solver.connect_terminator (&counter);
+    pigeon_hole (solver, 11);
+    int res = solver.solve_cubed (2, 2);
+    assert (!res);
+    assert (counter.calls > 5);
+  }
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Literal of 'idx' satisfied by the 'planted' assignment, where every odd
+// variable is true and every even variable is false.
+
+static int planted (int idx) { return (idx & 1) ? idx : -idx; }
+
+// Random 3-SAT clauses satisfied by the planted assignment and cycles of
+// binary implications over planted literals, which thus are equivalent.
+// With 'inconsistent' the first cycle continues with the negations of its
+// literals and thus contains both phases of its variables.
+
+static vector<vector<int>> formula (int vars, int clauses,
+                                    int cycles, bool inconsistent) {
+  vector<vector<int>> res;
+  unsigned state = 7;
+  auto next = [&state] () { return state = state * 1103515245u + 12345u; };
+  while ((int) res.size () < clauses) {
+    vector<int> clause;
+    bool satisfied = false;
+    for (int i = 0; i < 3; i++) {
+      const int idx = 1 + (next () >> 8) % vars;
+      const int lit = (next () >> 8) & 1 ? idx : -idx;
+      if (lit == planted (idx)) satisfied = true;
+      clause.push_back (lit);
+    }
+    if (satisfied) res.push_back (clause);
+  }
+  for (int i = 0; i < cycles; i++) {
+    const int length = 2 + (next () >> 8) % 4;
+    vector<int> cycle;
+    for (int j = 0; j < length; j++)
+      cycle.push_back (planted (1 + (next () >> 8) % vars));
+    if (inconsistent && !i)
+      for (int j = 0; j < length; j++)
+        cycle.push_back (-cycle[j]);
+    for (int j = 0; j < (int) cycle.size (); j++)
+      res.push_back ({-cycle[j], cycle[(j + 1) % cycle.size ()]});
+  }
+  return res;
+}
+
+struct Substituted : StatisticsIterator {
+  int64_t substituted = -1;
+  bool counter (const char * name, int64_t value) {
+    if (string (name) == "all.substituted") substituted = value;
+    return true;
+  }
+  bool time (const char *, double) { return true; }
+};
+
+static int64_t substituted (Solver & solver) {
+  Substituted it;
+  solver.traverse_statistics (it);
+  assert (it.substituted >= 0);
+  return it.substituted;
+}
+
+// Solve with internal checking after one round of simplification, which
+// starts with equivalent literal substitution, and return the number of
+// substituted variables.
+
+static int64_t solve (const vector<vector<int>> & clauses,
+                      int threads, int expected) {
+  Solver solver;
+  solver.set ("check", 1);
+  solver.set ("decomposethreads", threads);
+  for (const auto & clause : clauses) {
+    for (const auto & lit : clause) solver.add (lit);
+    solver.add (0);
+  }
+  int res = solver.simplify (1);
+  assert (!res || res == expected);
+  res = solver.solve ();
+  assert (res == expected);
+  if (res == 10)
+    for (const auto & clause : clauses) {
+      bool satisfied = false;
+      for (const auto & lit : clause)
+        if (solver.val (lit) > 0) satisfied = true;
+      assert (satisfied);
+    }
+  return substituted (solver);
+}
+
+int main () {
+
+  // The parallel version has to substitute exactly the same variables as
+  // the sequential one.
+
+  for (int inconsistent = 0; inconsistent <= 1; inconsistent++) {
+    const auto clauses = formula (300, 900, 20, inconsistent);
+    const int expected = inconsistent ? 20 : 10;
+    const int64_t sequential = solve (clauses, 1, expected);
+    const int64_t parallel = solve (clauses, 4, expected);
+    assert (parallel == sequential);
+    if (!inconsistent) assert (parallel > 0);
+  }
+
+  return 0;
+}
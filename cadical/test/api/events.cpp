@@ -0,0 +1,93 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace std;
+using namespace CaDiCaL;
+
+static string path () {
+  const char * prefix = getenv ("CADICALBUILD");
+  string res = prefix ? prefix : ".";
+  res += "/test-api-events.json";
+  return res;
+}
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (Solver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+// Write the recorded events and check that the first event begins a phase
+// and that every phase which ends has begun before.  Returns the number
+// of written events.
+
+static int check (Solver & solver) {
+  assert (!solver.write_events (path ().c_str ()));
+  FILE * file = fopen (path ().c_str (), "r");
+  assert (file);
+  char line[256];
+  assert (fgets (line, sizeof line, file));
+  assert (!strcmp (line, "{\"traceEvents\":[\n"));
+  int events = 0, depth = 0;
+  while (fgets (line, sizeof line, file)) {
+    if (!strstr (line, "\"name\":")) continue;
+    if (strstr (line, "\"ph\":\"B\"")) depth++;
+    else {
+      assert (strstr (line, "\"ph\":\"E\""));
+      assert (depth > 0);
+      depth--;
+    }
+    events++;
+  }
+  fclose (file);
+  return events;
+}
+
+int main () {
+
+  {
+    Solver solver;
+    solver.set ("events", 1000);
+    pigeon_hole (solver, 8);
+    int res = solver.solve ();
+    assert (res == 20);
+    assert (check (solver) > 2);
+  }
+
+  // A small ring buffer only keeps the last events.
+
+  {
+    Solver solver;
+    solver.set ("events", 8);
+    pigeon_hole (solver, 8);
+    solver.solve ();
+    assert (check (solver) <= 8);
+  }
+
+  {
+    Solver solver;
+    pigeon_hole (solver, 6);
+    solver.solve ();
+    assert (!check (solver));
+  }
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+static string path (const char * name = "formula") {
+  const char * prefix = getenv ("CADICALBUILD");
+  string res = prefix ? prefix : ".";
+  res += "/test-api-";
+  res += name;
+  res += ".bin";
+  return res;
+}
+
+// Write a formula file with the given header and literals.
+
+static string craft (const char * name, uint64_t size, uint64_t max_var,
+                     uint64_t clauses, const vector<int> & lits) {
+  const string res = path (name);
+  FILE * file = fopen (res.c_str (), "wb");
+  assert (file);
+  const uint64_t words[4] = {
+    0x616c756d726f4643ull, size, max_var, clauses
+  };
+  fwrite (words, sizeof words, 1, file);
+  fwrite (lits.data (), sizeof (int), lits.size (), file);
+  fclose (file);
+  return res;
+}
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes, where the first
+// pigeon is not forced to be in some hole, thus it is satisfiable.
+
+static void pigeon_hole (Formula & formula, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        formula.add (-ph (p1, h)), formula.add (-ph (p2, h)), formula.add (0);
+  for (int p = 1; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      formula.add (ph (p, h));
+    formula.add (0);
+  }
+}
+
+int main () {
+
+  Formula formula;
+  pigeon_hole (formula, 5);
+  assert (formula.vars () == 30);
+  assert (formula.clauses () == 80);
+
+  {
+    Formula copy = formula;
+    Solver first, second;
+    first.set ("check", 1);
+    first.attach (copy);
+    second.attach (formula);
+    assert (first.solve () == 10);
+
+    // Local clauses are kept separate from the shared ones.
+
+    for (int h = 0; h < 5; h++)
+      second.add (1 + 6*h);
+    second.add (0);
+    assert (second.solve () == 20);
+    assert (first.solve () == 10);
+  }
+
+  const char * err = formula.write (path ().c_str ());
+  assert (!err);
+
+  Formula mapped;
+  err = mapped.map (path ().c_str ());
+  assert (!err);
+  assert (mapped.vars () == formula.vars ());
+  assert (mapped.clauses () == formula.clauses ());
+  assert (mapped.size () == formula.size ());
+  for (size_t i = 0; i < mapped.size (); i++)
+    assert (mapped.literals ()[i] == formula.literals ()[i]);
+
+  {
+    Solver solver;
+    solver.set ("check", 1);
+    solver.set ("checkfailed", 1);
+    solver.attach (mapped);
+    for (int h = 0; h < 5; h++)
+      solver.assume (1 + 6*h);
+    assert (solver.solve () == 20);
+    solver.assume (-1);
+    assert (solver.solve () == 10);
+  }
+
+  err = mapped.map ("/non-existing/formula.bin");
+  assert (err);
+  assert (mapped.clauses () == 80);
+
+  // Crafted files with inconsistent headers or invalid literals.
+
+  const uint64_t overflow = (UINT64_MAX / sizeof (int)) + 1 + 3;
+  const string crafted[] = {
+    craft ("formula-valid", 3, 2, 1, {1, -2, 0}),
+    craft ("formula-overflow", overflow, 2, 1, {1, -2, 0}),
+    craft ("formula-max-var", 3, 1, 1, {1, -2, 0}),
+    craft ("formula-int-min", 3, 2, 1, {1, INT_MIN, 0}),
+    craft ("formula-clauses", 3, 2, 2, {1, -2, 0}),
+    craft ("formula-incomplete", 3, 2, 1, {1, -2, 1}),
+  };
+  for (const auto & name : crafted) {
+    Formula other;
+    err = other.map (name.c_str ());
+    if (&name == crafted) assert (!err && other.clauses () == 1);
+    else assert (err && !other.clauses ());
+  }
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (Solver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+struct Collector : HotspotIterator {
+  vector<int64_t> clauses, variables;
+  bool clause (const vector<int> & c, int64_t visits, int64_t steps) {
+    assert (c.size () > 1);
+    assert (visits > 0);
+    assert (steps >= 0);
+    for (const auto & lit : c) assert (abs (lit) <= 72);
+    clauses.push_back (visits + steps);
+    return true;
+  }
+  bool variable (int idx, int64_t propagations) {
+    assert (0 < idx && idx <= 72);
+    assert (propagations > 0);
+    variables.push_back (propagations);
+    return true;
+  }
+};
+
+int main () {
+
+  {
+    Solver solver;
+    solver.set ("hotspots", 1);
+    pigeon_hole (solver, 8);
+    int res = solver.solve ();
+    assert (res == 20);
+    Collector collector;
+    bool ok = solver.traverse_hotspots (collector, 5);
+    assert (ok);
+    assert (collector.clauses.size () == 5);
+    assert (collector.variables.size () == 5);
+    for (size_t i = 1; i < 5; i++) {
+      assert (collector.clauses[i-1] >= collector.clauses[i]);
+      assert (collector.variables[i-1] >= collector.variables[i]);
+    }
+
+    // Sampling every fourth literal gives fewer propagations.
+
+    Solver sampled;
+    sampled.set ("hotspots", 4);
+    pigeon_hole (sampled, 8);
+    sampled.solve ();
+    Collector fewer;
+    sampled.traverse_hotspots (fewer, 1);
+    assert (fewer.variables.size () == 1);
+    assert (fewer.variables[0] < collector.variables[0]);
+  }
+
+  {
+    Solver solver;
+    pigeon_hole (solver, 6);
+    int res = solver.solve ();
+    assert (res == 20);
+    Collector collector;
+    bool ok = solver.traverse_hotspots (collector);
+    assert (ok);
+    assert (collector.clauses.empty ());
+    assert (collector.variables.empty ());
+  }
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Imports the given clauses once (in order), which all are implied by the
+// pigeon hole formula below, since it is unsatisfiable.
+
+struct Provider : Importer {
+  vector<vector<int>> clauses;
+  size_t next = 0;
+  bool import (vector<int> & clause) {
+    if (next == clauses.size ()) return false;
+    clause = clauses[next++];
+    return true;
+  }
+};
+
+static int n = 9;
+
+static int ph (int p, int h) { return 1 + h * (n+1) + p; }
+
+int main () {
+
+  Solver solver;
+
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+
+  // Importing the empty clause (after a restart) makes it unsatisfiable
+  // much faster than solving the formula otherwise.
+
+  Provider provider;
+  provider.clauses.push_back ({ 1, -1, 2 });          // tautology skipped
+  provider.clauses.push_back ({ ph (0, 0), ph (1, 0) });
+  provider.clauses.push_back ({ -ph (0, 0) });
+  provider.clauses.push_back ({ -ph (1, 0) });
+  solver.connect_importer (&provider);
+
+  int res = solver.solve ();
+  assert (res == 20);
+  assert (provider.next == provider.clauses.size ());
+  solver.disconnect_importer ();
+
+  return 0;
+}
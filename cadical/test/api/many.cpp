@@ -0,0 +1,118 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (Solver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+// Random 3-SAT clauses satisfied by the 'planted' assignment, where every
+// odd variable is true and every even variable is false.
+
+static vector<vector<int>> planted (int vars, int clauses) {
+  vector<vector<int>> res;
+  unsigned state = 3;
+  auto next = [&state] () { return state = state * 1103515245u + 12345u; };
+  while ((int) res.size () < clauses) {
+    vector<int> clause;
+    bool satisfied = false;
+    for (int i = 0; i < 3; i++) {
+      const int idx = 1 + (next () >> 8) % vars;
+      const int lit = (next () >> 8) & 1 ? idx : -idx;
+      if ((lit > 0) == (idx & 1)) satisfied = true;
+      clause.push_back (lit);
+    }
+    if (satisfied) res.push_back (clause);
+  }
+  return res;
+}
+
+// Queries of ten random literals.  About half of them are unsatisfiable.
+
+static vector<vector<int>> queries (int vars, int count) {
+  vector<vector<int>> res;
+  unsigned state = 11;
+  auto next = [&state] () { return state = state * 1103515245u + 12345u; };
+  for (int i = 0; i < count; i++) {
+    vector<int> query;
+    for (int j = 0; j < 10; j++) {
+      const int idx = 1 + (next () >> 8) % vars;
+      query.push_back ((next () >> 8) & 1 ? idx : -idx);
+    }
+    res.push_back (query);
+  }
+  return res;
+}
+
+struct Counter : Terminator {
+  int calls = 0;
+  bool terminate () { return ++calls > 5; }
+};
+
+int main () {
+
+  const auto clauses = planted (150, 600);
+  const auto batch = queries (150, 60);
+
+  Solver solver;
+  for (const auto & clause : clauses) {
+    for (const auto & lit : clause) solver.add (lit);
+    solver.add (0);
+  }
+
+  vector<int> expected;
+  for (const auto & query : batch) {
+    for (const auto & lit : query) solver.assume (lit);
+    expected.push_back (solver.solve ());
+  }
+
+  for (int threads = 1; threads <= 3; threads += 2) {
+    auto res = solver.solve_many (batch, threads);
+    assert (res.results == expected);
+    assert (res.cores.size () == batch.size ());
+    for (size_t i = 0; i < batch.size (); i++) {
+      if (expected[i] != 20) { assert (res.cores[i].empty ()); continue; }
+      assert (!res.cores[i].empty ());
+      for (const auto & lit : res.cores[i])
+        solver.assume (lit);
+      assert (solver.solve () == 20);
+    }
+  }
+
+  assert (solver.solve_many ({}).results.empty ());
+  assert (solver.solve () == 10);
+
+  // The external terminator stops all workers, even after some of them
+  // ran out of queries.
+
+  {
+    Solver hard;
+    Counter counter;
+    hard.connect_terminator (&counter);
+    pigeon_hole (hard, 11);
+    auto res = hard.solve_many ({{1}, {-1}}, 4);
+    assert (res.results == vector<int> ({0, 0}));
+    assert (counter.calls > 5);
+  }
+
+  return 0;
+}
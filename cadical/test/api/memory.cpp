@@ -0,0 +1,85 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdlib>
+#include <map>
+#include <string>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (Solver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+struct Collector : StatisticsIterator {
+  map<string, int64_t> counters;
+  bool counter (const char * name, int64_t value) {
+    assert (!counters.count (name));
+    assert (value >= 0);
+    counters[name] = value;
+    return true;
+  }
+  bool time (const char *, double) { return true; }
+};
+
+int main () {
+
+  {
+    Solver solver;
+    pigeon_hole (solver, 8);
+    Collector before;
+    assert (solver.traverse_memory (before));
+    assert (before.counters["watches"] > 0);
+    assert (before.counters["vars"] > 0);
+    assert (!before.counters["checker"]);
+    int res = solver.solve ();
+    assert (res == 20);
+
+    // The total is the sum of all data structures.
+
+    Collector after;
+    assert (solver.traverse_memory (after));
+    int64_t sum = 0;
+    for (const auto & counter : after.counters)
+      if (counter.first != "total") sum += counter.second;
+    assert (sum == after.counters["total"]);
+    assert (after.counters.size () == 12);
+
+    Collector statistics;
+    solver.traverse_statistics (statistics);
+    assert (!statistics.counters["memlimited"]);
+  }
+
+  // Solving this formula needs about one megabyte, thus with that limit
+  // the memory checks force reductions.
+
+  {
+    Solver solver;
+    solver.set ("memlimit", 1);
+    solver.set ("memlimitint", 100);
+    pigeon_hole (solver, 8);
+    int res = solver.solve ();
+    assert (res == 20);
+    Collector statistics;
+    solver.traverse_statistics (statistics);
+    assert (statistics.counters["memlimited"] > 0);
+  }
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (PortfolioSolver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+// Random 3-SAT clauses satisfied by the 'planted' assignment, where every
+// odd variable is true and every even variable is false.
+
+static vector<vector<int>> planted (int vars, int clauses) {
+  vector<vector<int>> res;
+  unsigned state = 42;
+  auto next = [&state] () { return state = state * 1103515245u + 12345u; };
+  while ((int) res.size () < clauses) {
+    vector<int> clause;
+    bool satisfied = false;
+    for (int i = 0; i < 3; i++) {
+      const int idx = 1 + (next () >> 8) % vars;
+      const int lit = (next () >> 8) & 1 ? idx : -idx;
+      if ((lit > 0) == (idx & 1)) satisfied = true;
+      clause.push_back (lit);
+    }
+    if (satisfied) res.push_back (clause);
+  }
+  return res;
+}
+
+struct Conflicts : StatisticsIterator {
+  int64_t conflicts = -1;
+  bool counter (const char * name, int64_t value) {
+    if (std::string (name) == "conflicts") conflicts = value;
+    return true;
+  }
+  bool time (const char *, double) { return true; }
+};
+
+static int64_t conflicts (Solver * solver) {
+  Conflicts it;
+  solver->traverse_statistics (it);
+  assert (it.conflicts >= 0);
+  return it.conflicts;
+}
+
+struct Counter : Terminator {
+  int calls = 0;
+  bool terminate () { return ++calls > 5; }
+};
+
+int main () {
+
+  {
+    PortfolioSolver solver (4);
+    assert (solver.size () == 4);
+    assert (solver.winner () < 0);
+    pigeon_hole (solver, 7);
+    int res = solver.solve ();
+    assert (res == 20);
+    assert (solver.status () == 20);
+    assert (0 <= solver.winner () && solver.winner () < 4);
+  }
+
+  {
+    PortfolioSolver solver (3);
+    const auto clauses = planted (200, 800);
+    for (const auto & clause : clauses) {
+      for (const auto & lit : clause) solver.add (lit);
+      solver.add (0);
+    }
+    int res = solver.solve ();
+    assert (res == 10);
+    for (const auto & clause : clauses) {
+      bool satisfied = false;
+      for (const auto & lit : clause)
+        if (solver.val (lit) > 0) satisfied = true;
+      assert (satisfied);
+    }
+
+    // Incrementally add clauses and solve under assumptions.
+
+    solver.add (-1), solver.add (-2), solver.add (0);
+    solver.assume (1), solver.assume (2), solver.assume (3);
+    res = solver.solve ();
+    assert (res == 20);
+    assert (solver.failed (1));
+    assert (solver.failed (2));
+
+    res = solver.solve ();
+    assert (res == 10);
+    assert (solver.val (1) < 0 || solver.val (2) < 0);
+    assert (solver.vars () == 200);
+  }
+
+  // Deterministic mode gives the same winner, model and number of
+  // conflicts of every solver in every run.
+
+  {
+    int winner = -1;
+    vector<int> model;
+    vector<int64_t> counts;
+    for (int run = 0; run < 3; run++) {
+      PortfolioSolver solver (4);
+      solver.deterministic (100);
+      const auto clauses = planted (300, 1250);
+      for (const auto & clause : clauses) {
+        for (const auto & lit : clause) solver.add (lit);
+        solver.add (0);
+      }
+      int res = solver.solve ();
+      assert (res == 10);
+      vector<int> values;
+      for (int idx = 1; idx <= 300; idx++)
+        values.push_back (solver.val (idx));
+      vector<int64_t> current;
+      for (int idx = 0; idx < solver.size (); idx++)
+        current.push_back (conflicts (solver.solver (idx)));
+      if (!run) winner = solver.winner (), model = values, counts = current;
+      assert (solver.winner () == winner);
+      assert (values == model);
+      assert (current == counts);
+    }
+  }
+
+  {
+    PortfolioSolver solver (3);
+    solver.deterministic (50);
+    pigeon_hole (solver, 8);
+    int res = solver.solve ();
+    assert (res == 20);
+    assert (0 <= solver.winner () && solver.winner () < 3);
+  }
+
+  {
+    PortfolioSolver solver (2);
+    Counter counter;
+    solver.connect_terminator (&counter);
+    pigeon_hole (solver, 11);
+    int res = solver.solve ();
+    assert (!res);
+    assert (solver.winner () < 0);
+    assert (counter.calls > 5);
+  }
+
+  // Imported clauses can not be checked and thus internal proof checking
+  // requires to disable sharing.
+
+  {
+    PortfolioSolver solver (2);
+    solver.set ("check", 1);
+    solver.share (0, 0);
+    pigeon_hole (solver, 5);
+    int res = solver.solve ();
+    assert (res == 20);
+  }
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (ProcessPortfolioSolver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+// Random 3-SAT clauses satisfied by the 'planted' assignment, where every
+// odd variable is true and every even variable is false.
+
+static vector<vector<int>> planted (int vars, int clauses) {
+  vector<vector<int>> res;
+  unsigned state = 42;
+  auto next = [&state] () { return state = state * 1103515245u + 12345u; };
+  while ((int) res.size () < clauses) {
+    vector<int> clause;
+    bool satisfied = false;
+    for (int i = 0; i < 3; i++) {
+      const int idx = 1 + (next () >> 8) % vars;
+      const int lit = (next () >> 8) & 1 ? idx : -idx;
+      if ((lit > 0) == (idx & 1)) satisfied = true;
+      clause.push_back (lit);
+    }
+    if (satisfied) res.push_back (clause);
+  }
+  return res;
+}
+
+struct Counter : Terminator {
+  int calls = 0;
+  bool terminate () { return ++calls > 5; }
+};
+
+int main () {
+
+  {
+    ProcessPortfolioSolver solver (3);
+    assert (solver.size () == 3);
+    assert (solver.winner () < 0);
+    pigeon_hole (solver, 7);
+    int res = solver.solve ();
+    assert (res == 20);
+    assert (solver.status () == 20);
+    assert (0 <= solver.winner () && solver.winner () < 3);
+  }
+
+  {
+    ProcessPortfolioSolver solver (2);
+    const auto clauses = planted (200, 800);
+    for (const auto & clause : clauses) {
+      for (const auto & lit : clause) solver.add (lit);
+      solver.add (0);
+    }
+    int res = solver.solve ();
+    assert (res == 10);
+    for (const auto & clause : clauses) {
+      bool satisfied = false;
+      for (const auto & lit : clause)
+        if (solver.val (lit) > 0) satisfied = true;
+      assert (satisfied);
+    }
+
+    // Incrementally add clauses and solve under assumptions.
+
+    solver.add (-1), solver.add (-2), solver.add (0);
+    solver.assume (1), solver.assume (2), solver.assume (3);
+    res = solver.solve ();
+    assert (res == 20);
+    assert (solver.failed (1));
+    assert (solver.failed (2));
+    assert (!solver.failed (-1));
+
+    res = solver.solve ();
+    assert (res == 10);
+    assert (solver.val (1) < 0 || solver.val (2) < 0);
+    assert (solver.vars () == 200);
+  }
+
+  {
+    ProcessPortfolioSolver solver (2);
+    assert (solver.set ("phase", 0));
+    assert (!solver.set ("no-such-option", 1));
+    solver.share (0, 0);
+    pigeon_hole (solver, 6);
+    assert (solver.solve () == 20);
+    assert (!solver.error ());
+  }
+
+  {
+    ProcessPortfolioSolver solver (2);
+    Counter counter;
+    solver.connect_terminator (&counter);
+    pigeon_hole (solver, 11);
+    int res = solver.solve ();
+    assert (!res);
+    assert (solver.winner () < 0);
+    assert (!solver.error ());
+    assert (counter.calls > 5);
+  }
+
+  return 0;
+}
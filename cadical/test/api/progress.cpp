@@ -0,0 +1,81 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstring>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (Solver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+struct Recorder : Progress {
+  int calls = 0, searching = 0;
+  ProgressMetrics last;
+  void progress (const ProgressMetrics & metrics) {
+    if (calls++) {
+      assert (metrics.time >= last.time);
+      assert (metrics.conflicts >= last.conflicts);
+      assert (metrics.decisions >= last.decisions);
+      assert (metrics.learned >= last.learned);
+    }
+    assert (metrics.phase);
+    if (!strcmp (metrics.phase, "search")) searching++;
+    assert (metrics.trail >= metrics.level);
+    assert (metrics.memory > 0);
+    last = metrics;
+  }
+};
+
+int main () {
+
+  // With a zero interval every check calls back.
+
+  {
+    Solver solver;
+    Recorder recorder;
+    solver.connect_progress (&recorder, 0);
+    pigeon_hole (solver, 7);
+    int res = solver.solve ();
+    assert (res == 20);
+    assert (recorder.calls > 10);
+    assert (recorder.searching > 0);
+    assert (recorder.last.conflicts > 0);
+    assert (recorder.last.learned > 0);
+
+    const int calls = recorder.calls;
+    solver.disconnect_progress ();
+    solver.simplify ();
+    assert (recorder.calls == calls);
+  }
+
+  // With a long interval only the first check calls back.
+
+  {
+    Solver solver;
+    Recorder recorder;
+    solver.connect_progress (&recorder, 1000000);
+    pigeon_hole (solver, 7);
+    int res = solver.solve ();
+    assert (res == 20);
+    assert (recorder.calls == 1);
+  }
+
+  return 0;
+}
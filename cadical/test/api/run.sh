@@ -109,6 +109,19 @@ run terminate
 run learn
 run cfreeze
 run traverse
+run import
+run portfolio
+run processes
+run cubed
+run many
+run decompose
+run transred
+run statistics
+run progress
+run hotspots
+run events
+run memory
+run formula
 run cipasir
 
 [ "`grep DNTRACING $makefile`" = "" ] && run apitrace
@@ -0,0 +1,143 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+
+using namespace std;
+using namespace CaDiCaL;
+
+static string path () {
+  const char * prefix = getenv ("CADICALBUILD");
+  string res = prefix ? prefix : ".";
+  res += "/test-api-statistics.json";
+  return res;
+}
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+
+static void pigeon_hole (Solver & solver, int n) {
+  auto ph = [n] (int p, int h) { return 1 + h * (n+1) + p; };
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+}
+
+struct Collector : StatisticsIterator {
+  map<string, int64_t> counters;
+  map<string, double> times;
+  bool counter (const char * name, int64_t value) {
+    assert (!counters.count (name));
+    counters[name] = value;
+    return true;
+  }
+  bool time (const char * name, double seconds) {
+    assert (seconds >= 0);
+    times[name] = seconds;
+    return true;
+  }
+};
+
+struct Aborter : StatisticsIterator {
+  int calls = 0;
+  bool counter (const char *, int64_t) { return ++calls < 3; }
+  bool time (const char *, double) { return ++calls < 3; }
+};
+
+struct Stopper : Terminator {
+  atomic<bool> stop;
+  Stopper () : stop (false) { }
+  bool terminate () { return stop; }
+};
+
+int main () {
+
+  Solver solver;
+  pigeon_hole (solver, 6);
+  int res = solver.solve ();
+  assert (res == 20);
+
+  Collector collector;
+  assert (solver.traverse_statistics (collector));
+  assert (collector.counters["conflicts"] > 0);
+  assert (collector.counters.count ("propagations.search"));
+  assert (collector.counters["propagations.search"] > 0);
+  assert (collector.times.count ("process"));
+  assert (collector.times.count ("real"));
+
+  // Each learned clause is counted once in the histograms.
+
+  int64_t glue = 0, size = 0;
+  for (const auto & counter : collector.counters)
+    if (!counter.first.compare (0, 15, "histogram.glue."))
+      glue += counter.second;
+    else if (!counter.first.compare (0, 15, "histogram.size."))
+      size += counter.second;
+  const int64_t learned = collector.counters["learned.clauses"];
+  assert (learned > 0);
+  assert (glue == learned);
+  assert (size == learned);
+  assert (collector.counters.count ("histogram.glue.8"));
+  assert (collector.counters["histogram.chronological"] +
+          collector.counters["histogram.nonchronological"] == learned);
+
+  Aborter aborter;
+  assert (!solver.traverse_statistics (aborter));
+  assert (aborter.calls == 3);
+
+  assert (!solver.write_statistics (path ().c_str ()));
+  FILE * file = fopen (path ().c_str (), "r");
+  assert (file);
+  char line[256];
+  assert (fgets (line, sizeof line, file));
+  assert (!strcmp (line, "{\n"));
+  bool found = false;
+  while (fgets (line, sizeof line, file))
+    if (strstr (line, "\"conflicts\": ")) found = true;
+  fclose (file);
+  assert (found);
+
+  // Poll statistics from another thread while solving a hard formula,
+  // which is only stopped after the poller saw enough conflicts.
+
+  {
+    Solver hard;
+    Stopper stopper;
+    hard.connect_terminator (&stopper);
+    pigeon_hole (hard, 12);
+    int64_t polls = 0, last = 0;
+    thread poller ([&] () {
+      while (!stopper.stop) {
+        Collector snapshot;
+        assert (hard.traverse_statistics (snapshot));
+        const int64_t conflicts = snapshot.counters["conflicts"];
+        assert (conflicts >= last);
+        last = conflicts;
+        if (conflicts >= 2000) stopper.stop = true;
+        polls++;
+      }
+    });
+    res = hard.solve ();
+    poller.join ();
+    assert (!res);
+    assert (polls > 0);
+    assert (last >= 2000);
+  }
+
+  return 0;
+}
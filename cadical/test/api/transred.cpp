@@ -0,0 +1,128 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Literal of 'idx' satisfied by the 'planted' assignment, where every odd
+// variable is true and every even variable is false.
+
+static int planted (int idx) { return (idx & 1) ? idx : -idx; }
+
+// Random 3-SAT clauses satisfied by the planted assignment and chains of
+// binary implications over planted literals with transitive shortcuts
+// 'c[i] -> c[i+2]'.  Every other chain is closed to a cycle.  The chains
+// use separate variables (following the first 'vars' ones), since failed
+// literal probing on the random clauses would fix most of them otherwise.
+
+static vector<vector<int>> formula (int vars, int clauses, int chains) {
+  vector<vector<int>> res;
+  unsigned state = 5;
+  auto next = [&state] () { return state = state * 1103515245u + 12345u; };
+  while ((int) res.size () < clauses) {
+    vector<int> clause;
+    bool satisfied = false;
+    for (int i = 0; i < 3; i++) {
+      const int idx = 1 + (next () >> 8) % vars;
+      const int lit = (next () >> 8) & 1 ? idx : -idx;
+      if (lit == planted (idx)) satisfied = true;
+      clause.push_back (lit);
+    }
+    if (satisfied) res.push_back (clause);
+  }
+  for (int i = 0; i < chains; i++) {
+    const int length = 3 + (next () >> 8) % 4;
+    vector<int> chain;
+    for (int j = 0; j < length; j++)
+      chain.push_back (planted (vars + 1 + (next () >> 8) % vars));
+    for (int j = 0; j + 1 < length; j++)
+      res.push_back ({-chain[j], chain[j + 1]});
+    for (int j = 0; j + 2 < length; j++)
+      res.push_back ({-chain[j], chain[j + 2]});
+    if (i & 1) res.push_back ({-chain[length - 1], chain[0]});
+  }
+  return res;
+}
+
+struct Transred : StatisticsIterator {
+  int64_t transreds = -1, cyclic = -1, transitive = -1;
+  bool counter (const char * name, int64_t value) {
+    const string s = name;
+    if (s == "transreds") transreds = value;
+    if (s == "transredcyclic") cyclic = value;
+    if (s == "transitive") transitive = value;
+    return true;
+  }
+  bool time (const char *, double) { return true; }
+};
+
+// Solve with internal checking after one round of simplification, which
+// includes transitive reduction (in 'subsume' during 'elim').  A non-zero
+// 'limit' fixes the number of propagations of transitive reduction.
+
+static Transred solve (const vector<vector<int>> & clauses,
+                       bool bits, bool decompose, int limit = 0) {
+  Solver solver;
+  solver.set ("check", 1);
+  solver.set ("transredbits", bits);
+  solver.set ("decompose", decompose);
+  if (limit) {
+    solver.set ("transredmineff", limit);
+    solver.set ("transredmaxeff", limit);
+  }
+  for (const auto & clause : clauses) {
+    for (const auto & lit : clause) solver.add (lit);
+    solver.add (0);
+  }
+  int res = solver.simplify (1);
+  assert (!res || res == 10);
+  res = solver.solve ();
+  assert (res == 10);
+  for (const auto & clause : clauses) {
+    bool satisfied = false;
+    for (const auto & lit : clause)
+      if (solver.val (lit) > 0) satisfied = true;
+    assert (satisfied);
+  }
+  Transred it;
+  solver.traverse_statistics (it);
+  assert (it.transreds > 0);
+  assert (it.cyclic >= 0);
+  assert (it.transitive >= 0);
+  return it;
+}
+
+int main () {
+
+  const auto clauses = formula (300, 900, 40);
+
+  for (int decompose = 0; decompose <= 1; decompose++) {
+    const Transred search = solve (clauses, false, decompose);
+    const Transred bits = solve (clauses, true, decompose);
+    assert (!search.cyclic);
+    assert (bits.transitive > 0);
+
+    // Without equivalent literal substitution the cycles remain and the
+    // bit-parallel version has to fall back to breadth first search.
+
+    if (decompose) assert (!bits.cyclic);
+    else assert (bits.cyclic > 0);
+  }
+
+  // With a tight limit the topological ordering is abandoned before it
+  // finds any cycle and the breadth first search still removes transitive
+  // clauses within the other half of the limit.
+
+  const Transred limited = solve (clauses, true, false, 1000);
+  assert (!limited.cyclic);
+  assert (limited.transitive > 0);
+
+  return 0;
+}
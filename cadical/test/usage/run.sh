@@ -131,6 +131,12 @@ done
 # run 0 --no-colors # TODO all versions ....
 # run 0 --no-leak # not needed
 
+run 20 --simplify ../test/cnf/false.cnf
+run 0 --simplify ../test/cnf/prime65537.cnf
+run 0 --simplify -P1 ../test/cnf/prime65537.cnf
+run 1 --simplify -c 1 ../test/cnf/prime65537.cnf
+run 1 --simplify --simplify ../test/cnf/prime65537.cnf
+
 #--------------------------------------------------------------------------#
 
 # not needed since tested in '../cnf'
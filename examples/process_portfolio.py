@@ -0,0 +1,35 @@
+import itertools
+from pydical import ProcessPortfolioSolver, SATISFIABLE, UNSATISFIABLE
+
+# Pigeon hole formula solved by a portfolio of worker processes, which
+# exchange short learned clauses through shared memory.  Pressing Ctrl-C
+# terminates all workers.
+
+N = 9
+
+
+def ph(p, h):
+    return 1 + h * (N + 1) + p
+
+
+s = ProcessPortfolioSolver(4)
+s.share(8, 2)
+
+for h in range(N):
+    for p1, p2 in itertools.combinations(range(N + 1), 2):
+        s.add_clause([-ph(p1, h), -ph(p2, h)])
+
+for p in range(N + 1):
+    s.add_clause([ph(p, h) for h in range(N)])
+
+print(f"c solving with {s.size} worker processes")
+
+result = s.solve()
+
+print(f"c worker {s.winner} won")
+if result == SATISFIABLE:
+    print("s SATISFIABLE")
+elif result == UNSATISFIABLE:
+    print("s UNSATISFIABLE")
+else:
+    print("s UNKNOWN")
@@ -5,6 +5,7 @@
 #include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <stdexcept>
 
 namespace py = pybind11;
 
@@ -15,6 +16,10 @@ public:
   std::optional<std::exception_ptr> py_error;
   std::unique_ptr<CaDiCaL::Terminator> terminator;
   std::unique_ptr<CaDiCaL::Learner> learner;
+  std::unique_ptr<CaDiCaL::Progress> progress;
+
+  // Only changed and read while holding the GIL.
+  bool solving = false;
 
   void check_exception() {
     if (py_error) {
@@ -23,13 +28,50 @@ public:
       std::rethrow_exception(std::move(p));
     };
   }
+
+  void check_not_solving() {
+    if (solving)
+      throw std::runtime_error("can not call this method while solving");
+  }
 };
 
+// Marks the solver as solving for the duration of a solving call, during
+// which other Python threads (while the GIL is released) and call-backs
+// may only call 'terminate' and 'get_statistics'.
+class Solving {
+public:
+  Solver &solver;
+  Solving(Solver &solver) : solver(solver) {
+    solver.check_not_solving();
+    solver.solving = true;
+  }
+  ~Solving() { solver.solving = false; }
+};
+
+// Wraps a solver method to raise an exception instead of violating the
+// API contract if it is called while solving.
+template <typename R, typename... Args>
+auto guarded(R (CaDiCaL::Solver::*method)(Args...)) {
+  return [method](Solver &self, Args... args) -> R {
+    self.check_not_solving();
+    return (self.*method)(args...);
+  };
+}
+
+template <typename R, typename... Args>
+auto guarded(R (CaDiCaL::Solver::*method)(Args...) const) {
+  return [method](Solver &self, Args... args) -> R {
+    self.check_not_solving();
+    return (self.*method)(args...);
+  };
+}
+
 class InterruptTerminator : public CaDiCaL::Terminator {
 public:
   Solver &solver;
   InterruptTerminator(Solver &solver) : solver(solver) {}
   virtual bool terminate() override final {
+    py::gil_scoped_acquire acquire;
     try {
       if (PyErr_CheckSignals() != 0)
         throw py::error_already_set();
@@ -53,6 +95,7 @@ public:
   Terminator(Solver &solver, std::function<bool()> callback)
       : solver(solver), callback(std::move(callback)) {}
   virtual bool terminate() override final {
+    py::gil_scoped_acquire acquire;
     try {
       return callback();
     } catch (pybind11::error_already_set &e) {
@@ -62,16 +105,21 @@ public:
   }
 };
 
+// The literals of a learned clause are buffered and only passed to the
+// Python call-back at the end of the clause, so that the GIL is acquired
+// twice per clause instead of once per literal.
 class Learner : public CaDiCaL::Learner {
 public:
   Solver &solver;
   std::function<bool(int)> learning_callback;
   std::function<void(int)> learn_callback;
+  std::vector<int> clause;
   Learner(Solver &solver, std::function<bool(int)> learning_callback,
       std::function<void(int)> learn_callback)
       : solver(solver), learning_callback(std::move(learning_callback)),
         learn_callback(std::move(learn_callback)) {}
   virtual bool learning(int size) override final {
+    py::gil_scoped_acquire acquire;
     try {
       return learning_callback(size);
     } catch (pybind11::error_already_set &e) {
@@ -81,8 +129,33 @@ public:
     }
   }
   virtual void learn(int lit) override final {
+    clause.push_back(lit);
+    if (lit)
+      return;
+    py::gil_scoped_acquire acquire;
     try {
-      learn_callback(lit);
+      for (const auto &other : clause)
+        learn_callback(other);
+    } catch (pybind11::error_already_set &e) {
+      solver.py_error.emplace(std::current_exception());
+      solver.terminate();
+    }
+    clause.clear();
+  }
+};
+
+class Progress : public CaDiCaL::Progress {
+public:
+  Solver &solver;
+  std::function<void(const CaDiCaL::ProgressMetrics &)> callback;
+  Progress(Solver &solver,
+      std::function<void(const CaDiCaL::ProgressMetrics &)> callback)
+      : solver(solver), callback(std::move(callback)) {}
+  virtual void progress(
+      const CaDiCaL::ProgressMetrics &metrics) override final {
+    py::gil_scoped_acquire acquire;
+    try {
+      callback(metrics);
     } catch (pybind11::error_already_set &e) {
       solver.py_error.emplace(std::current_exception());
       solver.terminate();
@@ -116,6 +189,50 @@ public:
   }
 };
 
+class CollectingStatisticsIterator : public CaDiCaL::StatisticsIterator {
+public:
+  py::dict counters, times;
+  virtual bool counter(const char *name, int64_t value) override final {
+    counters[name] = value;
+    return true;
+  }
+  virtual bool time(const char *name, double seconds) override final {
+    times[name] = seconds;
+    return true;
+  }
+};
+
+// Collects statistics without touching Python objects, thus can be used
+// without holding the GIL, e.g., while waiting for the solving thread to
+// publish its statistics.
+class BufferingStatisticsIterator : public CaDiCaL::StatisticsIterator {
+public:
+  std::vector<std::pair<const char *, int64_t>> counters;
+  std::vector<std::pair<const char *, double>> times;
+  virtual bool counter(const char *name, int64_t value) override final {
+    counters.emplace_back(name, value);
+    return true;
+  }
+  virtual bool time(const char *name, double seconds) override final {
+    times.emplace_back(name, seconds);
+    return true;
+  }
+};
+
+class CollectingHotspotIterator : public CaDiCaL::HotspotIterator {
+public:
+  py::list clauses, variables;
+  virtual bool clause(const std::vector<int> &clause, int64_t visits,
+      int64_t steps) override final {
+    clauses.append(py::make_tuple(clause, visits, steps));
+    return true;
+  }
+  virtual bool variable(int idx, int64_t propagations) override final {
+    variables.append(py::make_tuple(idx, propagations));
+    return true;
+  }
+};
+
 class WitnessIterator : public CaDiCaL::WitnessIterator {
 public:
   Solver &solver;
@@ -146,24 +263,126 @@ public:
   }
 };
 
+class PortfolioSolver : public CaDiCaL::PortfolioSolver {
+public:
+  PortfolioSolver(int solvers);
+
+  std::optional<std::exception_ptr> py_error;
+  std::unique_ptr<CaDiCaL::Terminator> terminator;
+
+  void check_exception() {
+    if (py_error) {
+      std::exception_ptr p(std::move(*py_error));
+      py_error.reset();
+      std::rethrow_exception(std::move(p));
+    };
+  }
+};
+
+// The portfolio calls its terminator only from the thread calling 'solve',
+// i.e., while holding the GIL, but never from its solver threads.
+class PortfolioInterruptTerminator : public CaDiCaL::Terminator {
+public:
+  PortfolioSolver &solver;
+  PortfolioInterruptTerminator(PortfolioSolver &solver) : solver(solver) {}
+  virtual bool terminate() override final {
+    try {
+      if (PyErr_CheckSignals() != 0)
+        throw py::error_already_set();
+      return false;
+    } catch (pybind11::error_already_set &e) {
+      solver.py_error.emplace(std::current_exception());
+      return true;
+    }
+  }
+};
+
+PortfolioSolver::PortfolioSolver(int solvers)
+    : CaDiCaL::PortfolioSolver(solvers) {
+  terminator = std::make_unique<PortfolioInterruptTerminator>(*this);
+  connect_terminator(terminator.get());
+}
+
+class ProcessPortfolioSolver : public CaDiCaL::ProcessPortfolioSolver {
+public:
+  ProcessPortfolioSolver(int solvers);
+
+  std::optional<std::exception_ptr> py_error;
+  std::unique_ptr<CaDiCaL::Terminator> terminator;
+
+  void check_exception() {
+    if (py_error) {
+      std::exception_ptr p(std::move(*py_error));
+      py_error.reset();
+      std::rethrow_exception(std::move(p));
+    };
+  }
+};
+
+// The worker processes never call back into Python, the terminator is only
+// called in this process from the thread calling 'solve'.
+class ProcessPortfolioInterruptTerminator : public CaDiCaL::Terminator {
+public:
+  ProcessPortfolioSolver &solver;
+  ProcessPortfolioInterruptTerminator(ProcessPortfolioSolver &solver)
+      : solver(solver) {}
+  virtual bool terminate() override final {
+    try {
+      if (PyErr_CheckSignals() != 0)
+        throw py::error_already_set();
+      return false;
+    } catch (pybind11::error_already_set &e) {
+      solver.py_error.emplace(std::current_exception());
+      return true;
+    }
+  }
+};
+
+ProcessPortfolioSolver::ProcessPortfolioSolver(int solvers)
+    : CaDiCaL::ProcessPortfolioSolver(solvers) {
+  terminator = std::make_unique<ProcessPortfolioInterruptTerminator>(*this);
+  connect_terminator(terminator.get());
+}
+
 PYBIND11_MODULE(pydical, m) {
   m.doc() = R"pbdoc(
         Pydical Python interface for the CaDiCaL SAT solver
     )pbdoc";
 
+  auto metrics =
+      py::class_<CaDiCaL::ProgressMetrics>(m, "ProgressMetrics");
+  metrics.def_readonly("time", &CaDiCaL::ProgressMetrics::time);
+  metrics.def_readonly("conflicts", &CaDiCaL::ProgressMetrics::conflicts);
+  metrics.def_readonly("decisions", &CaDiCaL::ProgressMetrics::decisions);
+  metrics.def_readonly(
+      "propagations", &CaDiCaL::ProgressMetrics::propagations);
+  metrics.def_readonly("learned", &CaDiCaL::ProgressMetrics::learned);
+  metrics.def_readonly("redundant", &CaDiCaL::ProgressMetrics::redundant);
+  metrics.def_readonly(
+      "irredundant", &CaDiCaL::ProgressMetrics::irredundant);
+  metrics.def_readonly("trail", &CaDiCaL::ProgressMetrics::trail);
+  metrics.def_readonly("level", &CaDiCaL::ProgressMetrics::level);
+  metrics.def_readonly("fast_glue", &CaDiCaL::ProgressMetrics::fast_glue);
+  metrics.def_readonly("slow_glue", &CaDiCaL::ProgressMetrics::slow_glue);
+  metrics.def_readonly("stable", &CaDiCaL::ProgressMetrics::stable);
+  metrics.def_readonly("phase", &CaDiCaL::ProgressMetrics::phase);
+  metrics.def_readonly("memory", &CaDiCaL::ProgressMetrics::memory);
+
   auto cls = py::class_<Solver>(m, "Solver");
 
   cls.def(py::init());
   cls.def_property_readonly_static(
       "signature", [](py::object) { return Solver::signature(); });
-  cls.def("add", &Solver::add);
+  cls.def("add", guarded(&Solver::add));
   cls.def("add_clause", [](Solver &self, py::iterable it) {
+    self.check_not_solving();
     for (py::iterator::reference lit : it) {
       self.add(lit.cast<int>());
     }
     self.add(0);
   });
   cls.def("add_clauses", [](Solver &self, py::iterable it) {
+    self.check_not_solving();
     for (py::iterator::reference clause : it) {
       for (py::iterator::reference lit : *clause) {
         self.add(lit.cast<int>());
@@ -171,56 +390,110 @@ PYBIND11_MODULE(pydical, m) {
       self.add(0);
     }
   });
-  cls.def("assume", &Solver::assume);
+  cls.def("assume", guarded(&Solver::assume));
+  // Solving releases the GIL, so that other Python threads can run, e.g.,
+  // to poll 'get_statistics'.  Call-backs acquire it again.  All other
+  // methods except 'terminate' and 'get_statistics' raise an exception
+  // while solving.
   cls.def("solve", [](Solver &self) {
-    int result = self.solve();
+    Solving solving(self);
+    int result;
+    {
+      py::gil_scoped_release release;
+      result = self.solve();
+    }
     self.check_exception();
     return result;
   });
-  cls.def("val", &Solver::val);
-  cls.def("failed", &Solver::failed);
+  cls.def("val", guarded(&Solver::val));
+  cls.def("failed", guarded(&Solver::failed));
   cls.def("connect_interrupt_terminator",
       [](Solver &self, std::function<bool()> callback) {
+        self.check_not_solving();
         self.disconnect_terminator();
         self.terminator = std::make_unique<InterruptTerminator>(self);
         self.connect_terminator(self.terminator.get());
       });
   cls.def("connect_terminator", [](Solver &self,
                                     std::function<bool()> callback) {
+    self.check_not_solving();
     self.disconnect_terminator();
     self.terminator = std::make_unique<Terminator>(self, std::move(callback));
     self.connect_terminator(self.terminator.get());
   });
   cls.def("disconnect_terminator", [](Solver &self) {
+    self.check_not_solving();
     self.disconnect_terminator();
     self.terminator = nullptr;
   });
   cls.def("connect_learner",
       [](Solver &self, std::function<bool(int)> learning_callback,
           std::function<void(int)> learn_callback) {
+        self.check_not_solving();
         self.disconnect_learner();
-        self.learner = nullptr;
-        self.connect_learner(new Learner(
-            self, std::move(learning_callback), std::move(learn_callback)));
+        self.learner = std::make_unique<Learner>(
+            self, std::move(learning_callback), std::move(learn_callback));
+        self.connect_learner(self.learner.get());
       });
   cls.def("disconnect_learner", [](Solver &self) {
+    self.check_not_solving();
     self.disconnect_learner();
     self.learner = nullptr;
   });
+  cls.def(
+      "connect_progress",
+      [](Solver &self,
+          std::function<void(const CaDiCaL::ProgressMetrics &)> callback,
+          int interval) {
+        self.check_not_solving();
+        self.disconnect_progress();
+        self.progress = std::make_unique<Progress>(self, std::move(callback));
+        self.connect_progress(self.progress.get(), interval);
+      },
+      py::arg("callback"), py::arg("interval") = 1000);
+  cls.def("disconnect_progress", [](Solver &self) {
+    self.check_not_solving();
+    self.disconnect_progress();
+    self.progress = nullptr;
+  });
   cls.def("lookahead", [](Solver &self) {
+    Solving solving(self);
     int result = self.lookahead();
     self.check_exception();
     return result;
   });
   cls.def("generate_cubes", [](Solver &self, int depth) {
+    Solving solving(self);
     Solver::CubesWithStatus result = self.generate_cubes(depth);
     // Terminating this doesn't work, but at least we can report the
     // exception at the end
     self.check_exception();
     return std::make_pair(result.status, result.cubes);
   });
-  cls.def("reset_assumptions", &Solver::reset_assumptions);
+  // The connected terminator is only called from the calling thread, which
+  // holds the GIL, but never from the worker threads.
+  cls.def(
+      "solve_cubed",
+      [](Solver &self, int depth, int threads) {
+        Solving solving(self);
+        int result = self.solve_cubed(depth, threads);
+        self.check_exception();
+        return result;
+      },
+      py::arg("depth"), py::arg("threads") = 0);
+  cls.def(
+      "solve_many",
+      [](Solver &self, const std::vector<std::vector<int>> &queries,
+          int threads) {
+        Solving solving(self);
+        Solver::ResultsWithCores result = self.solve_many(queries, threads);
+        self.check_exception();
+        return std::make_pair(result.results, result.cores);
+      },
+      py::arg("queries"), py::arg("threads") = 0);
+  cls.def("reset_assumptions", guarded(&Solver::reset_assumptions));
   cls.def_property_readonly("state", [](Solver &self) {
+    self.check_not_solving();
     switch (self.state()) {
     case CaDiCaL::INITIALIZING:
       return "INITIALIZING";
@@ -242,69 +515,123 @@ PYBIND11_MODULE(pydical, m) {
       return "";
     }
   });
-  cls.def_property_readonly("status", &Solver::status);
+  cls.def_property_readonly("status", guarded(&Solver::status));
   cls.def_property_readonly_static(
       "version", [](py::object) { return Solver::version(); });
-  cls.def("copy", &Solver::copy);
+  cls.def("copy", guarded(&Solver::copy));
   cls.def("copy", [](Solver &self) {
+    self.check_not_solving();
     Solver *copy = new Solver;
     self.copy(*copy);
     return copy;
   });
-  cls.def_property_readonly("vars", &Solver::vars);
-  cls.def("reserve", &Solver::reserve);
+  cls.def("attach", guarded(&Solver::attach));
+  cls.def_property_readonly("vars", guarded(&Solver::vars));
+  cls.def("reserve", guarded(&Solver::reserve));
   cls.def_static("is_valid_option", &Solver::is_valid_option);
   cls.def_static("is_preprocessing_option", &Solver::is_preprocessing_option);
   cls.def_static("is_valid_long_option", &Solver::is_valid_long_option);
-  cls.def("get", &Solver::get);
-  cls.def("prefix", &Solver::prefix);
-  cls.def("set", &Solver::set);
-  cls.def("set_long_option", &Solver::set_long_option);
+  cls.def("get", guarded(&Solver::get));
+  cls.def("prefix", guarded(&Solver::prefix));
+  cls.def("set", guarded(&Solver::set));
+  cls.def("set_long_option", guarded(&Solver::set_long_option));
   cls.def_static("is_valid_configuration", &Solver::is_valid_configuration);
-  cls.def("configure", &Solver::configure);
-  cls.def("optimize", &Solver::optimize);
-  cls.def("limit", &Solver::limit);
-  cls.def("is_valid_limit", &Solver::is_valid_limit);
-  cls.def_property_readonly("active", &Solver::active);
-  cls.def_property_readonly("redundant", &Solver::redundant);
-  cls.def_property_readonly("irredundant", &Solver::irredundant);
+  cls.def("configure", guarded(&Solver::configure));
+  cls.def("optimize", guarded(&Solver::optimize));
+  cls.def("limit", guarded(&Solver::limit));
+  cls.def("is_valid_limit", guarded(&Solver::is_valid_limit));
+  cls.def_property_readonly("active", guarded(&Solver::active));
+  cls.def_property_readonly("redundant", guarded(&Solver::redundant));
+  cls.def_property_readonly("irredundant", guarded(&Solver::irredundant));
   cls.def("simplify", [](Solver &self, int rounds) {
-    int result = self.simplify(rounds);
+    Solving solving(self);
+    int result;
+    {
+      py::gil_scoped_release release;
+      result = self.simplify(rounds);
+    }
     self.check_exception();
     return result;
   });
   cls.def("simplify", [](Solver &self) {
-    int result = self.simplify();
+    Solving solving(self);
+    int result;
+    {
+      py::gil_scoped_release release;
+      result = self.simplify();
+    }
     self.check_exception();
     return result;
   });
   cls.def("terminate", &Solver::terminate);
-  cls.def("frozen", &Solver::frozen);
-  cls.def("freeze", &Solver::freeze);
-  cls.def("melt", &Solver::melt);
-  cls.def("fixed", &Solver::fixed);
-  cls.def("phase", &Solver::phase);
-  cls.def("unphase", &Solver::unphase);
+  cls.def("frozen", guarded(&Solver::frozen));
+  cls.def("freeze", guarded(&Solver::freeze));
+  cls.def("melt", guarded(&Solver::melt));
+  cls.def("fixed", guarded(&Solver::fixed));
+  cls.def("phase", guarded(&Solver::phase));
+  cls.def("unphase", guarded(&Solver::unphase));
   cls.def("trace_proof", [](Solver &self, FILE *file, const char *name) {
+    self.check_not_solving();
     return self.trace_proof(file, name);
   });
-  cls.def("trace_proof",
-      [](Solver &self, const char *name) { return self.trace_proof(name); });
-  cls.def("flush_proof_trace", &Solver::flush_proof_trace);
-  cls.def("close_proof_trace", &Solver::close_proof_trace);
+  cls.def("trace_proof", [](Solver &self, const char *name) {
+    self.check_not_solving();
+    return self.trace_proof(name);
+  });
+  cls.def("flush_proof_trace", guarded(&Solver::flush_proof_trace));
+  cls.def("close_proof_trace", guarded(&Solver::close_proof_trace));
   cls.def_static("usage", &Solver::usage);
   cls.def_static("configurations", &Solver::configurations);
-  cls.def("statistics", &Solver::statistics);
-  cls.def("resources", &Solver::resources);
-  cls.def("options", &Solver::options);
+  cls.def("statistics", guarded(&Solver::statistics));
+  cls.def("resources", guarded(&Solver::resources));
+  cls.def("get_statistics", [](Solver &self) {
+    BufferingStatisticsIterator it;
+    {
+      py::gil_scoped_release release;
+      self.traverse_statistics(it);
+    }
+    py::dict counters, times;
+    for (const auto &counter : it.counters)
+      counters[counter.first] = counter.second;
+    for (const auto &time : it.times)
+      times[time.first] = time.second;
+    py::dict result;
+    result["counters"] = counters;
+    result["times"] = times;
+    return result;
+  });
+  cls.def("get_memory", [](Solver &self) {
+    self.check_not_solving();
+    CollectingStatisticsIterator it;
+    self.traverse_memory(it);
+    return it.counters;
+  });
+  cls.def("write_statistics", guarded(&Solver::write_statistics));
+  cls.def("hotspots", guarded(&Solver::hotspots), py::arg("limit") = 10);
+  cls.def("write_events", guarded(&Solver::write_events));
+  cls.def(
+      "get_hotspots",
+      [](Solver &self, int limit) {
+        self.check_not_solving();
+        CollectingHotspotIterator it;
+        self.traverse_hotspots(it, limit);
+        py::dict result;
+        result["clauses"] = it.clauses;
+        result["variables"] = it.variables;
+        return result;
+      },
+      py::arg("limit") = 10);
+  cls.def("options", guarded(&Solver::options));
   cls.def("traverse_clauses",
       [](Solver &self, std::function<bool(const std::vector<int> &)> callback) {
+        self.check_not_solving();
         ClauseIterator it(self, std::move(callback));
         bool result = self.traverse_clauses(it);
         self.check_exception();
         return result;
       });
   cls.def("clauses", [](Solver &self) {
+    self.check_not_solving();
     CollectingClauseIterator it;
     self.traverse_clauses(it);
     return it.clauses;
@@ -313,6 +640,7 @@ PYBIND11_MODULE(pydical, m) {
       [](Solver &self, std::function<bool(
                            const std::vector<int> &, const std::vector<int> &)>
                            callback) {
+        self.check_not_solving();
         WitnessIterator it(self, std::move(callback));
         bool result = self.traverse_witnesses_backward(it);
         self.check_exception();
@@ -322,12 +650,14 @@ PYBIND11_MODULE(pydical, m) {
       [](Solver &self, std::function<bool(
                            const std::vector<int> &, const std::vector<int> &)>
                            callback) {
+        self.check_not_solving();
         WitnessIterator it(self, std::move(callback));
         bool result = self.traverse_witnesses_forward(it);
         self.check_exception();
         return result;
       });
   cls.def("witnesses", [](Solver &self) {
+    self.check_not_solving();
     CollectingWitnessIterator it;
     self.traverse_witnesses_forward(it);
     return it.clauses;
@@ -337,27 +667,32 @@ PYBIND11_MODULE(pydical, m) {
 // overloads below accept file paths, so this isn't essential.
   cls.def("read_dimacs",
       [](Solver &self, FILE *file, const char *name, int strict) {
+        self.check_not_solving();
         int vars = -1;
         const char *msg = self.read_dimacs(file, name, vars, strict);
         return std::make_pair(msg, vars);
       });
   cls.def("read_dimacs", [](Solver &self, FILE *file, const char *name) {
+    self.check_not_solving();
     int vars = -1;
     const char *msg = self.read_dimacs(file, name, vars, 1);
     return std::make_pair(msg, vars);
   });
 #endif
   cls.def("read_dimacs", [](Solver &self, const char *name, int strict) {
+    self.check_not_solving();
     int vars = -1;
     const char *msg = self.read_dimacs(name, vars, strict);
     return std::make_pair(msg, vars);
   });
   cls.def("read_dimacs", [](Solver &self, const char *name) {
+    self.check_not_solving();
     int vars = -1;
     const char *msg = self.read_dimacs(name, vars, 1);
     return std::make_pair(msg, vars);
   });
   cls.def("read_dimacs_inccnf", [](Solver &self, const char *name, int strict) {
+    self.check_not_solving();
     int vars = -1;
     bool incremental = false;
     std::vector<int> cubes;
@@ -365,18 +700,128 @@ PYBIND11_MODULE(pydical, m) {
     return std::make_tuple(msg, vars, incremental, cubes);
   });
   cls.def("read_dimacs_inccnf", [](Solver &self, const char *name) {
+    self.check_not_solving();
     int vars = -1;
     bool incremental = false;
     std::vector<int> cubes;
     const char *msg = self.read_dimacs(name, vars, 1, incremental, cubes);
     return std::make_tuple(msg, vars, incremental, cubes);
   });
-  cls.def("write_dimacs", &Solver::write_dimacs);
-  cls.def("write_dimacs",
-      [](Solver &self, const char *path) { return self.write_dimacs(path); });
-  cls.def("write_extension", &Solver::write_extension);
+  cls.def("write_dimacs", guarded(&Solver::write_dimacs));
+  cls.def("write_dimacs", [](Solver &self, const char *path) {
+    self.check_not_solving();
+    return self.write_dimacs(path);
+  });
+  cls.def("write_extension", guarded(&Solver::write_extension));
   // Skipping the build function, as it only supports output to stdout or stderr
 
+  auto formula = py::class_<CaDiCaL::Formula>(m, "Formula");
+
+  formula.def(py::init());
+  formula.def("add", &CaDiCaL::Formula::add);
+  formula.def("add_clause", [](CaDiCaL::Formula &self, py::iterable it) {
+    for (py::iterator::reference lit : it) {
+      self.add(lit.cast<int>());
+    }
+    self.add(0);
+  });
+  formula.def("add_clauses", [](CaDiCaL::Formula &self, py::iterable it) {
+    for (py::iterator::reference clause : it) {
+      for (py::iterator::reference lit : *clause) {
+        self.add(lit.cast<int>());
+      }
+      self.add(0);
+    }
+  });
+  formula.def("write", [](CaDiCaL::Formula &self, const char *path) {
+    if (const char *err = self.write(path))
+      throw std::runtime_error(err);
+  });
+  formula.def("map", [](CaDiCaL::Formula &self, const char *path) {
+    if (const char *err = self.map(path))
+      throw std::runtime_error(err);
+  });
+  formula.def_property_readonly("vars", &CaDiCaL::Formula::vars);
+  formula.def_property_readonly("clauses", &CaDiCaL::Formula::clauses);
+
+  auto portfolio = py::class_<PortfolioSolver>(m, "PortfolioSolver");
+
+  portfolio.def(py::init<int>(), py::arg("solvers") = 0);
+  portfolio.def("add", &PortfolioSolver::add);
+  portfolio.def("add_clause", [](PortfolioSolver &self, py::iterable it) {
+    for (py::iterator::reference lit : it) {
+      self.add(lit.cast<int>());
+    }
+    self.add(0);
+  });
+  portfolio.def("add_clauses", [](PortfolioSolver &self, py::iterable it) {
+    for (py::iterator::reference clause : it) {
+      for (py::iterator::reference lit : *clause) {
+        self.add(lit.cast<int>());
+      }
+      self.add(0);
+    }
+  });
+  portfolio.def("assume", &PortfolioSolver::assume);
+  portfolio.def("solve", [](PortfolioSolver &self) {
+    int result = self.solve();
+    self.check_exception();
+    return result;
+  });
+  portfolio.def("val", &PortfolioSolver::val);
+  portfolio.def("failed", &PortfolioSolver::failed);
+  portfolio.def("terminate", &PortfolioSolver::terminate);
+  portfolio.def("set", &PortfolioSolver::set);
+  portfolio.def("share", &PortfolioSolver::share);
+  portfolio.def("deterministic", &PortfolioSolver::deterministic);
+  portfolio.def_property_readonly("vars", &PortfolioSolver::vars);
+  portfolio.def_property_readonly("size", &PortfolioSolver::size);
+  portfolio.def_property_readonly("status", &PortfolioSolver::status);
+  portfolio.def_property_readonly("winner", &PortfolioSolver::winner);
+  portfolio.def("statistics", [](PortfolioSolver &self, int idx) {
+    self.solver(idx)->statistics();
+  });
+
+  auto processes =
+      py::class_<ProcessPortfolioSolver>(m, "ProcessPortfolioSolver");
+
+  processes.def(py::init<int>(), py::arg("solvers") = 0);
+  processes.def("add", &ProcessPortfolioSolver::add);
+  processes.def("add_clause",
+      [](ProcessPortfolioSolver &self, py::iterable it) {
+        for (py::iterator::reference lit : it) {
+          self.add(lit.cast<int>());
+        }
+        self.add(0);
+      });
+  processes.def("add_clauses",
+      [](ProcessPortfolioSolver &self, py::iterable it) {
+        for (py::iterator::reference clause : it) {
+          for (py::iterator::reference lit : *clause) {
+            self.add(lit.cast<int>());
+          }
+          self.add(0);
+        }
+      });
+  processes.def("assume", &ProcessPortfolioSolver::assume);
+  processes.def("solve", [](ProcessPortfolioSolver &self) {
+    int result = self.solve();
+    self.check_exception();
+    if (!result && self.error())
+      throw std::runtime_error(self.error());
+    return result;
+  });
+  processes.def("val", &ProcessPortfolioSolver::val);
+  processes.def("failed", &ProcessPortfolioSolver::failed);
+  processes.def("terminate", &ProcessPortfolioSolver::terminate);
+  processes.def("set", &ProcessPortfolioSolver::set);
+  processes.def("share", &ProcessPortfolioSolver::share);
+  processes.def_property_readonly("vars", &ProcessPortfolioSolver::vars);
+  processes.def_property_readonly("size", &ProcessPortfolioSolver::size);
+  processes.def_property_readonly("status", &ProcessPortfolioSolver::status);
+  processes.def_property_readonly("winner", &ProcessPortfolioSolver::winner);
+  processes.def_property_readonly("error", &ProcessPortfolioSolver::error);
+
 #ifdef VERSION_INFO
   m.attr("__version__") = VERSION_INFO;
 #else